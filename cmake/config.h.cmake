@@ -28,5 +28,6 @@
 #cmakedefine USE_CUSTOM_ALLTOALLV
 #cmakedefine BARRIER_IN_ALLTOALLV
 #cmakedefine HAVE_PARMETIS
+#cmakedefine HAVE_THREAD_LOCAL_GKRAND
 
 #endif /* CLIQUE_CONFIG_H */
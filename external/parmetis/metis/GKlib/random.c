@@ -60,10 +60,15 @@ GK_MKRANDOM(gk_idx, size_t, gk_idx_t)
 #define LM 0x7FFFFFFFULL /* Least significant 31 bits */
 
 
+/* Local patch (see external/parmetis/PATCHES): the state is thread-local so
+   that concurrent, seeded callers see reproducible sequences. Clique's build
+   checks for the following define before bisecting in parallel. */
+#define GK_THREAD_LOCAL_RAND 1
+
 /* The array for the state vector */
-static uint64_t mt[NN]; 
+static metis__thread uint64_t mt[NN]; 
 /* mti==NN+1 means mt[NN] is not initialized */
-static int mti=NN+1; 
+static metis__thread int mti=NN+1; 
 #endif /* USE_GKRAND */
 
 /* initializes mt[NN] with a seed */
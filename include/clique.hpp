@@ -11,6 +11,8 @@
 #define CLIQUE_HPP
 
 #include <algorithm>
+#include <fstream>
+#include <limits>
 #include <map>
 #include <set>
 
@@ -60,6 +62,7 @@ namespace cliq {
 #include "clique/core/dist_map/decl.hpp"
 #include "clique/core/sparse_matrix/decl.hpp"
 #include "clique/core/dist_sparse_matrix/decl.hpp"
+#include "clique/core/dist_block_sparse_matrix/decl.hpp"
 #include "clique/core/multi_vec/decl.hpp"
 #include "clique/core/dist_multi_vec/decl.hpp"
 
@@ -70,6 +73,7 @@ namespace cliq {
 #include "clique/core/dist_map/impl.hpp"
 #include "clique/core/sparse_matrix/impl.hpp"
 #include "clique/core/dist_sparse_matrix/impl.hpp"
+#include "clique/core/dist_block_sparse_matrix/impl.hpp"
 #include "clique/core/multi_vec/impl.hpp"
 #include "clique/core/dist_multi_vec/impl.hpp"
 
@@ -81,19 +85,25 @@ namespace cliq {
 #include "clique/symbolic/dist_symm_elim_tree.hpp"
 #include "clique/symbolic/dist_symm_info.hpp"
 #include "clique/symbolic/symm_analysis.hpp"
+#include "clique/symbolic/factorization_prediction.hpp"
 #include "clique/symbolic/nested_dissection.hpp"
 #include "clique/symbolic/natural_nested_dissection.hpp"
+#include "clique/symbolic/geometric_nested_dissection.hpp"
+#include "clique/symbolic/nested_dissection_cache/decl.hpp"
+#include "clique/symbolic/nested_dissection_cache/impl.hpp"
 
 //
 // Numerical computation
 //
 
-#include "clique/numeric/multiply.hpp"
-
 #include "clique/numeric/dist_nodal_multi_vec/decl.hpp"
 #include "clique/numeric/dist_nodal_matrix/decl.hpp"
+#include "clique/numeric/dist_nodal_sparse_matrix/decl.hpp"
 #include "clique/numeric/dist_nodal_multi_vec/impl.hpp"
 #include "clique/numeric/dist_nodal_matrix/impl.hpp"
+#include "clique/numeric/dist_nodal_sparse_matrix/impl.hpp"
+
+#include "clique/numeric/multiply.hpp"
 
 #include "clique/numeric/dist_symm_front_tree/decl.hpp"
 #include "clique/numeric/dist_symm_front_tree/impl.hpp"
@@ -102,7 +112,10 @@ namespace cliq {
 #include "clique/numeric/ldl.hpp"
 #include "clique/numeric/lower_solve.hpp"
 #include "clique/numeric/diagonal_solve.hpp"
+#include "clique/numeric/dist_symm_solver/decl.hpp"
 #include "clique/numeric/solve.hpp"
+#include "clique/numeric/dist_symm_solver/impl.hpp"
+#include "clique/numeric/krylov.hpp"
 #include "clique/numeric/lower_multiply.hpp"
 
 //
@@ -0,0 +1,84 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, and Stanford University
+   All rights reserved.
+ 
+   This file is part of Clique and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef CLIQ_CORE_DISTBLOCKSPARSEMATRIX_DECL_HPP
+#define CLIQ_CORE_DISTBLOCKSPARSEMATRIX_DECL_HPP
+
+namespace cliq {
+
+// A sparse matrix built from dense blockDim x blockDim blocks, e.g., for PDEs
+// with several degrees of freedom per grid point. Only one (row,col) pair is
+// stored per block, and the sparsity pattern of the blocks (the quotient 
+// graph) is stored as a DistGraph, so that the block rows use the same simple
+// 1d distribution as DistSparseMatrix. Each block is stored in column-major
+// order.
+template<typename T>
+class DistBlockSparseMatrix
+{
+public:
+    // Construction and destruction
+    DistBlockSparseMatrix();
+    DistBlockSparseMatrix( mpi::Comm comm );
+    DistBlockSparseMatrix( int numBlockRows, int blockDim, mpi::Comm comm );
+    ~DistBlockSparseMatrix();
+
+    // High-level information
+    int Height() const;
+    int Width() const;
+    int NumBlockRows() const;
+    int BlockDim() const;
+    const cliq::DistGraph& LockedDistGraph() const;
+
+    // Communicator-management
+    void SetComm( mpi::Comm comm );
+    mpi::Comm Comm() const;
+
+    // Distribution information
+    int FirstLocalBlockRow() const;
+    int LocalBlockHeight() const;
+
+    // Assembly-related routines
+    void StartAssembly();
+    void StopAssembly();
+    void Reserve( int numLocalBlocks );
+    // Add the blockDim x blockDim matrix, B, onto block (blockRow,blockCol)
+    void Update( int blockRow, int blockCol, const Matrix<T>& B );
+
+    // Local data
+    int BlockRow( int localBlock ) const;
+    int BlockCol( int localBlock ) const;
+    const T* LockedBlockBuffer( int localBlock ) const;
+    int NumLocalBlocks() const;
+    int LocalBlockOffset( int localBlockRow ) const;
+    int NumConnections( int localBlockRow ) const;
+
+    // For modifying the size of the matrix
+    void Empty();
+    void ResizeTo( int numBlockRows, int blockDim );
+
+    // Cached metadata for multiplication, where colOffs[k] is the position 
+    // within the received rows of X of the first row of block column k
+    mutable SparseMultMeta<T> multMeta;
+
+private:
+    int blockDim_;
+    cliq::DistGraph distGraph_;
+    std::vector<T> vals_;
+};
+
+// Redistribute the expansion of a block sparse matrix into the scalar 
+// distribution of a DistSparseMatrix (e.g., for forming a frontal tree)
+template<typename T>
+void ExpandBlocks
+( const DistBlockSparseMatrix<T>& ABlock, DistSparseMatrix<T>& A );
+
+} // namespace cliq
+
+#endif // ifndef CLIQ_CORE_DISTBLOCKSPARSEMATRIX_DECL_HPP
@@ -0,0 +1,292 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, and Stanford University
+   All rights reserved.
+ 
+   This file is part of Clique and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef CLIQ_CORE_DISTBLOCKSPARSEMATRIX_IMPL_HPP
+#define CLIQ_CORE_DISTBLOCKSPARSEMATRIX_IMPL_HPP
+
+namespace cliq {
+
+template<typename T>
+inline 
+DistBlockSparseMatrix<T>::DistBlockSparseMatrix()
+: blockDim_(1)
+{ }
+
+template<typename T>
+inline 
+DistBlockSparseMatrix<T>::DistBlockSparseMatrix( mpi::Comm comm )
+: blockDim_(1), distGraph_(comm)
+{ }
+
+template<typename T>
+inline 
+DistBlockSparseMatrix<T>::DistBlockSparseMatrix
+( int numBlockRows, int blockDim, mpi::Comm comm )
+: blockDim_(blockDim), distGraph_(numBlockRows,comm)
+{ 
+    DEBUG_ONLY(
+        CallStackEntry cse("DistBlockSparseMatrix::DistBlockSparseMatrix")
+    )
+    if( blockDim < 1 )
+        LogicError("Block dimension must be positive");
+}
+
+template<typename T>
+inline 
+DistBlockSparseMatrix<T>::~DistBlockSparseMatrix()
+{ }
+
+template<typename T>
+inline int 
+DistBlockSparseMatrix<T>::Height() const
+{ return blockDim_*distGraph_.NumSources(); }
+
+template<typename T>
+inline int 
+DistBlockSparseMatrix<T>::Width() const
+{ return blockDim_*distGraph_.NumTargets(); }
+
+template<typename T>
+inline int 
+DistBlockSparseMatrix<T>::NumBlockRows() const
+{ return distGraph_.NumSources(); }
+
+template<typename T>
+inline int 
+DistBlockSparseMatrix<T>::BlockDim() const
+{ return blockDim_; }
+
+template<typename T>
+inline const cliq::DistGraph& 
+DistBlockSparseMatrix<T>::LockedDistGraph() const
+{ return distGraph_; }
+
+template<typename T>
+inline void
+DistBlockSparseMatrix<T>::SetComm( mpi::Comm comm )
+{ 
+    multMeta.ready = false;
+    distGraph_.SetComm( comm ); 
+    SwapClear( vals_ );
+}
+
+template<typename T>
+inline mpi::Comm 
+DistBlockSparseMatrix<T>::Comm() const
+{ return distGraph_.Comm(); }
+
+template<typename T>
+inline int
+DistBlockSparseMatrix<T>::FirstLocalBlockRow() const
+{ return distGraph_.FirstLocalSource(); }
+
+template<typename T>
+inline int
+DistBlockSparseMatrix<T>::LocalBlockHeight() const
+{ return distGraph_.NumLocalSources(); }
+
+template<typename T>
+inline void
+DistBlockSparseMatrix<T>::StartAssembly()
+{
+    DEBUG_ONLY(CallStackEntry cse("DistBlockSparseMatrix::StartAssembly"))
+    multMeta.ready = false;
+    distGraph_.StartAssembly();
+}
+
+template<typename T>
+inline void
+DistBlockSparseMatrix<T>::StopAssembly()
+{
+    DEBUG_ONLY(CallStackEntry cse("DistBlockSparseMatrix::StopAssembly"))
+    if( !distGraph_.assembling_ )
+        LogicError("Cannot stop assembly without starting");
+    distGraph_.assembling_ = false;
+
+    // Sort the blocks and sum any updates to the same block (even if the 
+    // insertions were already in order, they may contain duplicates)
+    SortAndCompressEdges
+    ( distGraph_.firstLocalSource_, distGraph_.numLocalSources_,
+      distGraph_.sources_, distGraph_.targets_, &vals_, 
+      distGraph_.localEdgeOffsets_, blockDim_*blockDim_ );
+    distGraph_.sorted_ = true;
+}
+
+template<typename T>
+inline void
+DistBlockSparseMatrix<T>::Reserve( int numLocalBlocks )
+{ 
+    distGraph_.Reserve( numLocalBlocks );
+    vals_.reserve( numLocalBlocks*blockDim_*blockDim_ );
+}
+
+template<typename T>
+inline void
+DistBlockSparseMatrix<T>::Update
+( int blockRow, int blockCol, const Matrix<T>& B )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("DistBlockSparseMatrix::Update");
+        if( B.Height() != blockDim_ || B.Width() != blockDim_ )
+            LogicError("Block was not the correct size");
+    )
+    distGraph_.Insert( blockRow, blockCol );
+    for( int j=0; j<blockDim_; ++j )
+        for( int i=0; i<blockDim_; ++i )
+            vals_.push_back( B.Get(i,j) );
+}
+
+template<typename T>
+inline int
+DistBlockSparseMatrix<T>::BlockRow( int localBlock ) const
+{ 
+    DEBUG_ONLY(CallStackEntry cse("DistBlockSparseMatrix::BlockRow"))
+    return distGraph_.Source( localBlock );
+}
+
+template<typename T>
+inline int
+DistBlockSparseMatrix<T>::BlockCol( int localBlock ) const
+{ 
+    DEBUG_ONLY(CallStackEntry cse("DistBlockSparseMatrix::BlockCol"))
+    return distGraph_.Target( localBlock );
+}
+
+template<typename T>
+inline const T*
+DistBlockSparseMatrix<T>::LockedBlockBuffer( int localBlock ) const
+{ return &vals_[localBlock*blockDim_*blockDim_]; }
+
+template<typename T>
+inline int
+DistBlockSparseMatrix<T>::NumLocalBlocks() const
+{ return distGraph_.NumLocalEdges(); }
+
+template<typename T>
+inline int
+DistBlockSparseMatrix<T>::LocalBlockOffset( int localBlockRow ) const
+{ return distGraph_.LocalEdgeOffset( localBlockRow ); }
+
+template<typename T>
+inline int
+DistBlockSparseMatrix<T>::NumConnections( int localBlockRow ) const
+{ return distGraph_.NumConnections( localBlockRow ); }
+
+template<typename T>
+inline void
+DistBlockSparseMatrix<T>::Empty()
+{
+    multMeta.ready = false;
+    distGraph_.Empty();
+    SwapClear( vals_ );
+}
+
+template<typename T>
+inline void
+DistBlockSparseMatrix<T>::ResizeTo( int numBlockRows, int blockDim )
+{
+    DEBUG_ONLY(CallStackEntry cse("DistBlockSparseMatrix::ResizeTo"))
+    if( blockDim < 1 )
+        LogicError("Block dimension must be positive");
+    multMeta.ready = false;
+    blockDim_ = blockDim;
+    distGraph_.ResizeTo( numBlockRows );
+    SwapClear( vals_ );
+}
+
+template<typename T>
+inline void
+ExpandBlocks( const DistBlockSparseMatrix<T>& ABlock, DistSparseMatrix<T>& A )
+{
+    DEBUG_ONLY(CallStackEntry cse("ExpandBlocks"))
+    mpi::Comm comm = ABlock.Comm();
+    const int commSize = mpi::CommSize( comm );
+    const int blockDim = ABlock.BlockDim();
+    const int numBlockEntries = blockDim*blockDim;
+    const int numLocalBlocks = ABlock.NumLocalBlocks();
+    A.SetComm( comm );
+    A.ResizeTo( ABlock.Height(), ABlock.Width() );
+    const int blocksize = A.Blocksize();
+
+    // Send each scalar entry to the owner of its row
+    std::vector<int> sendSizes( commSize, 0 );
+    for( int k=0; k<numLocalBlocks; ++k )
+    {
+        const int rowOff = ABlock.BlockRow(k)*blockDim;
+        for( int i=0; i<blockDim; ++i )
+            sendSizes[RowToProcess( rowOff+i, blocksize, commSize )] += 
+                blockDim;
+    }
+    int numSends=0;
+    std::vector<int> sendOffs( commSize );
+    for( int q=0; q<commSize; ++q )
+    {
+        sendOffs[q] = numSends;
+        numSends += sendSizes[q];
+    }
+    std::vector<int> sendRows( numSends ), sendCols( numSends );
+    std::vector<T> sendVals( numSends );
+    std::vector<int> offs = sendOffs;
+    for( int k=0; k<numLocalBlocks; ++k )
+    {
+        const int rowOff = ABlock.BlockRow(k)*blockDim;
+        const int colOff = ABlock.BlockCol(k)*blockDim;
+        const T* block = ABlock.LockedBlockBuffer( k );
+        for( int i=0; i<blockDim; ++i )
+        {
+            const int q = RowToProcess( rowOff+i, blocksize, commSize );
+            for( int j=0; j<blockDim; ++j )
+            {
+                sendRows[offs[q]] = rowOff+i;
+                sendCols[offs[q]] = colOff+j;
+                sendVals[offs[q]] = block[i+j*blockDim];
+                ++offs[q];
+            }
+        }
+    }
+    SwapClear( offs );
+    std::vector<int> recvSizes( commSize );
+    mpi::AllToAll( &sendSizes[0], 1, &recvSizes[0], 1, comm );
+    int numRecvs=0;
+    std::vector<int> recvOffs( commSize );
+    for( int q=0; q<commSize; ++q )
+    {
+        recvOffs[q] = numRecvs;
+        numRecvs += recvSizes[q];
+    }
+    DEBUG_ONLY(
+        if( numLocalBlocks*numBlockEntries != numSends )
+            LogicError("Did not send every entry");
+    )
+    std::vector<int> recvRows( numRecvs ), recvCols( numRecvs );
+    std::vector<T> recvVals( numRecvs );
+    mpi::AllToAll
+    ( &sendRows[0], &sendSizes[0], &sendOffs[0],
+      &recvRows[0], &recvSizes[0], &recvOffs[0], comm );
+    mpi::AllToAll
+    ( &sendCols[0], &sendSizes[0], &sendOffs[0],
+      &recvCols[0], &recvSizes[0], &recvOffs[0], comm );
+    mpi::AllToAll
+    ( &sendVals[0], &sendSizes[0], &sendOffs[0],
+      &recvVals[0], &recvSizes[0], &recvOffs[0], comm );
+    SwapClear( sendRows );
+    SwapClear( sendCols );
+    SwapClear( sendVals );
+
+    A.StartAssembly();
+    A.Reserve( numRecvs );
+    for( int s=0; s<numRecvs; ++s )
+        A.Update( recvRows[s], recvCols[s], recvVals[s] );
+    A.StopAssembly();
+}
+
+} // namespace cliq
+
+#endif // ifndef CLIQ_CORE_DISTBLOCKSPARSEMATRIX_IMPL_HPP
@@ -33,6 +33,10 @@ public:
     int NumSources() const;
     int NumTargets() const;
 
+    // Whether only the lower triangle of a symmetric pattern is stored, as is
+    // the case for the graph of a DistSparseMatrix with lower storage
+    bool LowerStorage() const;
+
     // Communicator-management
     void SetComm( mpi::Comm comm );
     mpi::Comm Comm() const;
@@ -49,16 +53,20 @@ public:
     void Insert( int source, int target );
     int Capacity() const;
 
+    // Adopt the buffers of our local sources in compressed sparse row (CSR)
+    // format, where the targets of each source are strictly increasing. The 
+    // input buffers are swapped in (and the passed-in vectors are left empty).
+    void AdoptCSR( std::vector<int>& offsets, std::vector<int>& targets );
+
     // Local data
     int NumLocalEdges() const;
     int Source( int localEdge ) const;
     int Target( int localEdge ) const;
     int LocalEdgeOffset( int localSource ) const;
     int NumConnections( int localSource ) const;
-    int* SourceBuffer();
     int* TargetBuffer();
-    const int* LockedSourceBuffer() const;
     const int* LockedTargetBuffer() const;
+    const int* LockedOffsetBuffer() const;
 
     // For resizing the graph
     void Empty();
@@ -76,25 +84,32 @@ private:
     int blocksize_;
     int firstLocalSource_, numLocalSources_;
 
+    // The edges are stored in compressed sparse row format, and the source 
+    // of each edge is only explicitly stored during assembly
     std::vector<int> sources_, targets_;
+    std::vector<int> localEdgeOffsets_;
 
     // Helpers for local indexing
     bool assembling_, sorted_;
-    std::vector<int> localEdgeOffsets_;
+    bool lowerStorage_;
     void ComputeLocalEdgeOffsets();
 
-    static bool ComparePairs
-    ( const std::pair<int,int>& a, const std::pair<int,int>& b );
-
     void EnsureNotAssembling() const;
     void EnsureConsistentSizes() const;
     void EnsureConsistentCapacities() const;
 
     friend class Graph;
     template<typename F> friend class DistSparseMatrix;
+    template<typename F> friend class DistBlockSparseMatrix;
     template<typename F> friend struct DistSymmFrontTree;
+    friend void Symmetrize( const DistGraph& graph, DistGraph& symmGraph );
 };
 
+// Form the union of a square graph and its transpose, e.g., so that the 
+// sparsity pattern of a matrix which only stores its lower triangle can be 
+// passed to nested dissection
+void Symmetrize( const DistGraph& graph, DistGraph& symmGraph );
+
 } // namespace cliq
 
 #endif // ifndef CLIQ_CORE_DISTGRAPH_DECL_HPP
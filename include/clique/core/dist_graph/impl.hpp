@@ -15,22 +15,24 @@ namespace cliq {
 
 inline 
 DistGraph::DistGraph()
-: numSources_(0), numTargets_(0), comm_(mpi::COMM_WORLD)
+: numSources_(0), numTargets_(0), comm_(mpi::COMM_WORLD), lowerStorage_(false)
 { SetComm( mpi::COMM_WORLD ); }
 
 inline
 DistGraph::DistGraph( mpi::Comm comm )
-: numSources_(0), numTargets_(0), comm_(mpi::COMM_WORLD)
+: numSources_(0), numTargets_(0), comm_(mpi::COMM_WORLD), lowerStorage_(false)
 { SetComm( comm ); }
 
 inline 
 DistGraph::DistGraph( int numVertices, mpi::Comm comm )
-: numSources_(numVertices), numTargets_(numVertices), comm_(mpi::COMM_WORLD)
+: numSources_(numVertices), numTargets_(numVertices), comm_(mpi::COMM_WORLD),
+  lowerStorage_(false)
 { SetComm( comm ); }
 
 inline 
 DistGraph::DistGraph( int numSources, int numTargets, mpi::Comm comm )
-: numSources_(numSources), numTargets_(numTargets), comm_(mpi::COMM_WORLD)
+: numSources_(numSources), numTargets_(numTargets), comm_(mpi::COMM_WORLD),
+  lowerStorage_(false)
 { SetComm( comm ); }
 
 inline
@@ -65,6 +67,10 @@ inline int
 DistGraph::NumTargets() const
 { return numTargets_; }
 
+inline bool
+DistGraph::LowerStorage() const
+{ return lowerStorage_; }
+
 inline void 
 DistGraph::SetComm( mpi::Comm comm )
 {
@@ -90,6 +96,7 @@ DistGraph::SetComm( mpi::Comm comm )
         numLocalSources_ = blocksize_;
     else
         numLocalSources_ = numSources_ - (commSize-1)*blocksize_;
+    localEdgeOffsets_.assign( numLocalSources_+1, 0 );
 }
 
 inline mpi::Comm 
@@ -115,7 +122,7 @@ DistGraph::NumLocalEdges() const
         CallStackEntry cse("DistGraph::NumLocalEdges");
         EnsureConsistentSizes();
     )
-    return sources_.size();
+    return targets_.size();
 }
 
 inline int
@@ -126,7 +133,7 @@ DistGraph::Capacity() const
         EnsureConsistentSizes();
         EnsureConsistentCapacities();
     )
-    return sources_.capacity();
+    return targets_.capacity();
 }
 
 inline int
@@ -134,11 +141,17 @@ DistGraph::Source( int localEdge ) const
 {
     DEBUG_ONLY(
         CallStackEntry cse("DistGraph::Source");
-        if( localEdge < 0 || localEdge >= (int)sources_.size() )
+        if( localEdge < 0 || localEdge >= (int)targets_.size() )
             LogicError("Edge number out of bounds");
     )
     EnsureNotAssembling();
-    return sources_[localEdge];
+    // Only the offsets of the sources are stored, so search for the last 
+    // source whose edges begin at or before this edge
+    const int localSource = 
+        std::upper_bound
+        ( localEdgeOffsets_.begin(), localEdgeOffsets_.end(), localEdge ) - 
+        localEdgeOffsets_.begin() - 1;
+    return firstLocalSource_ + localSource;
 }
 
 inline int
@@ -177,22 +190,18 @@ DistGraph::NumConnections( int localSource ) const
     return LocalEdgeOffset(localSource+1) - LocalEdgeOffset(localSource);
 }
 
-inline int*
-DistGraph::SourceBuffer()
-{ return &sources_[0]; }
-
 inline int*
 DistGraph::TargetBuffer()
 { return &targets_[0]; }
 
-inline const int*
-DistGraph::LockedSourceBuffer() const
-{ return &sources_[0]; }
-
 inline const int*
 DistGraph::LockedTargetBuffer() const
 { return &targets_[0]; }
 
+inline const int*
+DistGraph::LockedOffsetBuffer() const
+{ return &localEdgeOffsets_[0]; }
+
 inline const DistGraph&
 DistGraph::operator=( const Graph& graph )
 {
@@ -207,6 +216,7 @@ DistGraph::operator=( const Graph& graph )
 
     sorted_ = graph.sorted_;
     assembling_ = graph.assembling_;
+    lowerStorage_ = false;
     localEdgeOffsets_ = graph.edgeOffsets_;
     return *this;
 }
@@ -225,21 +235,25 @@ DistGraph::operator=( const DistGraph& graph )
 
     sorted_ = graph.sorted_;
     assembling_ = graph.assembling_;
+    lowerStorage_ = graph.lowerStorage_;
     localEdgeOffsets_ = graph.localEdgeOffsets_;
     return *this;
 }
 
-inline bool
-DistGraph::ComparePairs
-( const std::pair<int,int>& a, const std::pair<int,int>& b )
-{ return a.first < b.first || (a.first == b.first && a.second < b.second); }
-
 inline void
 DistGraph::StartAssembly()
 {
     DEBUG_ONLY(CallStackEntry cse("DistGraph::StartAssembly"))
     EnsureNotAssembling();
     assembling_ = true;
+
+    // The source of each edge is only explicitly stored during assembly
+    const int numLocalEdges = targets_.size();
+    sources_.reserve( targets_.capacity() );
+    sources_.resize( numLocalEdges );
+    for( int s=0; s<numLocalSources_; ++s )
+        for( int e=localEdgeOffsets_[s]; e<localEdgeOffsets_[s+1]; ++e )
+            sources_[e] = firstLocalSource_ + s;
 }
 
 inline void
@@ -250,60 +264,32 @@ DistGraph::StopAssembly()
         LogicError("Cannot stop assembly without starting");
     assembling_ = false;
 
-    // Ensure that the connection pairs are sorted
-    if( !sorted_ )
-    {
-        const int numLocalEdges = sources_.size();
-        std::vector<std::pair<int,int> > pairs( numLocalEdges );
-        for( int e=0; e<numLocalEdges; ++e )
-        {
-            pairs[e].first = sources_[e];
-            pairs[e].second = targets_[e];
-        }
-        std::sort( pairs.begin(), pairs.end(), ComparePairs );
-
-        // Compress out duplicates
-        int lastUnique=0;
-        for( int e=1; e<numLocalEdges; ++e )
-            if( pairs[e] != pairs[lastUnique] )
-                pairs[++lastUnique] = pairs[e];
-        const int numUnique = lastUnique+1;
-
-        sources_.resize( numUnique );
-        targets_.resize( numUnique );
-        for( int e=0; e<numUnique; ++e )
-        {
-            sources_[e] = pairs[e].first;
-            targets_[e] = pairs[e].second;
-        }
-    }
-
-    ComputeLocalEdgeOffsets();
+    // Sort the connection pairs and remove any duplicates
+    SortAndCompressEdges<int>
+    ( firstLocalSource_, numLocalSources_, sources_, targets_, 0, 
+      localEdgeOffsets_ );
+    sorted_ = true;
 }
 
 inline void
 DistGraph::ComputeLocalEdgeOffsets()
 {
     DEBUG_ONLY(CallStackEntry cse("DistGraph::ComputeLocalEdgeOffsets"))
-    // Compute the local edge offsets
-    int sourceOffset = 0;
-    int prevSource = firstLocalSource_-1;
-    localEdgeOffsets_.resize( numLocalSources_+1 );
-    const int numLocalEdges = NumLocalEdges();
+    // Compress the (sorted) sources of the edges into offsets
+    localEdgeOffsets_.assign( numLocalSources_+1, 0 );
+    const int numLocalEdges = sources_.size();
     for( int localEdge=0; localEdge<numLocalEdges; ++localEdge )
     {
-        const int source = Source( localEdge );
+        const int localSource = sources_[localEdge] - firstLocalSource_;
         DEBUG_ONLY(
-            if( source < prevSource )
+            if( localEdge > 0 && sources_[localEdge] < sources_[localEdge-1] )
                 RuntimeError("sources were not properly sorted");
         )
-        while( source != prevSource )
-        {
-            localEdgeOffsets_[sourceOffset++] = localEdge;
-            ++prevSource;
-        }
+        ++localEdgeOffsets_[localSource+1];
     }
-    localEdgeOffsets_[numLocalSources_] = numLocalEdges;
+    for( int s=0; s<numLocalSources_; ++s )
+        localEdgeOffsets_[s+1] += localEdgeOffsets_[s];
+    SwapClear( sources_ );
 }
 
 inline void
@@ -347,6 +333,39 @@ DistGraph::Insert( int source, int target )
     targets_.push_back( target );
 }
 
+inline void
+DistGraph::AdoptCSR( std::vector<int>& offsets, std::vector<int>& targets )
+{
+    DEBUG_ONLY(CallStackEntry cse("DistGraph::AdoptCSR"))
+    EnsureNotAssembling();
+    if( (int)offsets.size() != numLocalSources_+1 )
+        LogicError("Expected one offset per local source, plus one");
+    if( offsets[0] != 0 || offsets[numLocalSources_] != (int)targets.size() )
+        LogicError("Offsets did not match the number of targets");
+    // Since the targets of each source must already be strictly increasing,
+    // a single pass suffices in place of sorting and compression
+    for( int s=0; s<numLocalSources_; ++s )
+    {
+        const int edgeBeg = offsets[s];
+        const int edgeEnd = offsets[s+1];
+        if( edgeEnd < edgeBeg )
+            LogicError("Offsets must be non-decreasing");
+        for( int e=edgeBeg; e<edgeEnd; ++e )
+        {
+            if( targets[e] < 0 || targets[e] >= numTargets_ )
+                LogicError("Target was out of bounds");
+            if( e > edgeBeg && targets[e] <= targets[e-1] )
+                LogicError("Targets of each source must strictly increase");
+        }
+    }
+    localEdgeOffsets_.swap( offsets );
+    targets_.swap( targets );
+    SwapClear( offsets );
+    SwapClear( targets );
+    SwapClear( sources_ );
+    sorted_ = true;
+}
+
 inline void
 DistGraph::Empty()
 {
@@ -359,7 +378,7 @@ DistGraph::Empty()
     numLocalSources_ = 0;
     sorted_ = true;
     assembling_ = false;
-    SwapClear( localEdgeOffsets_ );
+    localEdgeOffsets_.assign( 1, 0 );
 }
 
 inline void
@@ -383,7 +402,7 @@ DistGraph::ResizeTo( int numSources, int numTargets )
     SwapClear( targets_ );
     sorted_ = true;
     assembling_ = false;
-    SwapClear( localEdgeOffsets_ );
+    localEdgeOffsets_.assign( numLocalSources_+1, 0 );
 }
 
 inline void
@@ -396,17 +415,104 @@ DistGraph::EnsureNotAssembling() const
 inline void
 DistGraph::EnsureConsistentSizes() const
 { 
-    if( sources_.size() != targets_.size() )
+    if( assembling_ && sources_.size() != targets_.size() )
         LogicError("Inconsistent graph sizes");
+    if( !assembling_ && 
+        localEdgeOffsets_[numLocalSources_] != (int)targets_.size() )
+        LogicError("Inconsistent graph offsets");
 }
 
 inline void
 DistGraph::EnsureConsistentCapacities() const
 { 
-    if( sources_.capacity() != targets_.capacity() )
+    if( assembling_ && sources_.capacity() != targets_.capacity() )
         LogicError("Inconsistent graph capacities");
 }
 
+inline void
+Symmetrize( const DistGraph& graph, DistGraph& symmGraph )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("Symmetrize");
+        if( graph.NumSources() != graph.NumTargets() )
+            LogicError("Graph must be square");
+    )
+    mpi::Comm comm = graph.Comm();
+    const int commSize = mpi::CommSize( comm );
+    const int blocksize = graph.Blocksize();
+    const int firstLocalSource = graph.FirstLocalSource();
+    const int numLocalSources = graph.NumLocalSources();
+    const int numLocalEdges = graph.NumLocalEdges();
+    const int* offsets = graph.LockedOffsetBuffer();
+    const int* targets = graph.LockedTargetBuffer();
+
+    // Send each off-diagonal edge, (s,t), to the owner of t as (t,s)
+    std::vector<int> sendSizes( commSize, 0 );
+    for( int sLocal=0; sLocal<numLocalSources; ++sLocal )
+    {
+        const int s = firstLocalSource + sLocal;
+        for( int e=offsets[sLocal]; e<offsets[sLocal+1]; ++e )
+            if( s != targets[e] )
+                ++sendSizes[RowToProcess( targets[e], blocksize, commSize )];
+    }
+    std::vector<int> sendOffs( commSize );
+    int numSends=0;
+    for( int q=0; q<commSize; ++q )
+    {
+        sendOffs[q] = numSends;
+        numSends += sendSizes[q];
+    }
+    std::vector<int> sendSources( numSends ), sendTargets( numSends );
+    std::vector<int> offs = sendOffs;
+    for( int sLocal=0; sLocal<numLocalSources; ++sLocal )
+    {
+        const int s = firstLocalSource + sLocal;
+        for( int e=offsets[sLocal]; e<offsets[sLocal+1]; ++e )
+        {
+            if( s != targets[e] )
+            {
+                const int q = RowToProcess( targets[e], blocksize, commSize );
+                sendSources[offs[q]] = targets[e];
+                sendTargets[offs[q]] = s;
+                ++offs[q];
+            }
+        }
+    }
+    SwapClear( offs );
+    std::vector<int> recvSizes( commSize );
+    mpi::AllToAll( &sendSizes[0], 1, &recvSizes[0], 1, comm );
+    std::vector<int> recvOffs( commSize );
+    int numRecvs=0;
+    for( int q=0; q<commSize; ++q )
+    {
+        recvOffs[q] = numRecvs;
+        numRecvs += recvSizes[q];
+    }
+    std::vector<int> recvSources( numRecvs ), recvTargets( numRecvs );
+    mpi::AllToAll
+    ( &sendSources[0], &sendSizes[0], &sendOffs[0],
+      &recvSources[0], &recvSizes[0], &recvOffs[0], comm );
+    mpi::AllToAll
+    ( &sendTargets[0], &sendSizes[0], &sendOffs[0],
+      &recvTargets[0], &recvSizes[0], &recvOffs[0], comm );
+    SwapClear( sendSources );
+    SwapClear( sendTargets );
+
+    // Combine the original and transposed edges (duplicates are removed 
+    // when assembly is finished)
+    symmGraph.SetComm( comm );
+    symmGraph.ResizeTo( graph.NumSources() );
+    symmGraph.lowerStorage_ = false;
+    symmGraph.StartAssembly();
+    symmGraph.Reserve( numLocalEdges+numRecvs );
+    for( int sLocal=0; sLocal<numLocalSources; ++sLocal )
+        for( int e=offsets[sLocal]; e<offsets[sLocal+1]; ++e )
+            symmGraph.Insert( firstLocalSource+sLocal, targets[e] );
+    for( int e=0; e<numRecvs; ++e )
+        symmGraph.Insert( recvSources[e], recvTargets[e] );
+    symmGraph.StopAssembly();
+}
+
 } // namespace cliq
 
 #endif // ifndef CLIQ_CORE_DISTGRAPH_IMPL_HPP
@@ -44,6 +44,11 @@ public:
     void SetLocal( int localRow, int col, T value );
     void UpdateLocal( int localRow, int col, T value );
 
+    // Raw access to the column-major local data
+    T* Buffer();
+    const T* LockedBuffer() const;
+    int LDim() const;
+
     // For modifying the size of the multi-vector
     void Empty();
     void ResizeTo( int height, int width );
@@ -243,6 +243,21 @@ DistMultiVec<T>::UpdateLocal( int localRow, int col, T value )
     multiVec_.Update(localRow,col,value);
 }
 
+template<typename T>
+inline T*
+DistMultiVec<T>::Buffer()
+{ return multiVec_.Buffer(); }
+
+template<typename T>
+inline const T*
+DistMultiVec<T>::LockedBuffer() const
+{ return multiVec_.LockedBuffer(); }
+
+template<typename T>
+inline int
+DistMultiVec<T>::LDim() const
+{ return multiVec_.LDim(); }
+
 template<typename T>
 inline void
 DistMultiVec<T>::Empty()
@@ -13,6 +13,12 @@
 
 namespace cliq {
 
+// For a DistSparseMatrix, colOffs indexes into the local rows of X for
+// locally-owned columns and into the received ghost values otherwise. The
+// locally-owned columns of local row i lie in [localBegs[i],localEnds[i]),
+// which allows the local portion of a multiply to overlap the ghost exchange.
+// The row offsets and (sorted) ghost indices are kept so that a reassembly
+// with an identical sparsity pattern can reuse the metadata.
 template<typename T>
 struct SparseMultMeta
 {
@@ -20,7 +26,8 @@ struct SparseMultMeta
     int numRecvInds;
     std::vector<int> sendSizes, sendOffs,
                      recvSizes, recvOffs;
-    std::vector<int> sendInds, colOffs;
+    std::vector<int> sendInds, recvInds, colOffs;
+    std::vector<int> rowOffs, localBegs, localEnds;
 
     SparseMultMeta() : ready(false) { }
 };
@@ -55,13 +62,38 @@ public:
     int FirstLocalRow() const;
     int LocalHeight() const;
 
+    // Symmetric storage: if enabled, only the lower triangle is kept and the
+    // upper triangle is implicitly its (conjugate-)transpose. This must be
+    // set before any entries are added.
+    void SetLowerStorage( bool lowerStorage=true, bool conjugate=false );
+    bool LowerStorage() const;
+    bool ConjugateStorage() const;
+
     // Assembly-related routines
     void StartAssembly();
     void StopAssembly();
     void Reserve( int numLocalEntries );
+    // Updates to rows owned by other processes are stashed and then routed 
+    // to their owners during StopAssembly (which is therefore collective)
     void Update( int row, int col, T value );
     int Capacity() const;
 
+    // Once the pattern is frozen, StartAssembly zeroes the values, updates 
+    // are added directly onto the existing entries (and must lie within the 
+    // pattern), and StopAssembly neither sorts nor invalidates any metadata
+    void FreezePattern( bool freeze=true );
+    bool FrozenPattern() const;
+    // The local index of an entry in a locally-owned row (-1 if not present),
+    // which may be computed once and then used for O(1) updates
+    int Slot( int row, int col ) const;
+    void UpdateSlot( int slot, T value );
+
+    // Adopt CSR buffers for our local rows (with strictly increasing columns 
+    // within each row) without any sorting or per-entry insertion. As in 
+    // StopAssembly, the SpMV metadata is kept if the pattern is unchanged.
+    void AdoptCSR
+    ( std::vector<int>& offsets, std::vector<int>& cols, std::vector<T>& vals );
+
     // Local data
     int Row( int localInd ) const;
     int Col( int localInd ) const;
@@ -70,12 +102,11 @@ public:
     int LocalEntryOffset( int localRow ) const;
     int NumConnections( int localRow ) const;
 
-    int* SourceBuffer();
     int* TargetBuffer();
     T* ValueBuffer();
-    const int* LockedSourceBuffer() const;
     const int* LockedTargetBuffer() const;
     const T* LockedValueBuffer() const;
+    const int* LockedOffsetBuffer() const;
 
     // For modifying the size of the matrix
     void Empty();
@@ -88,8 +119,14 @@ public:
 private:
     cliq::DistGraph distGraph_;
     std::vector<T> vals_;
+    bool lowerStorage_, conjugateStorage_, frozenPattern_, refilling_;
+
+    // Updates to rows which we do not own
+    std::vector<Entry<T> > stash_;
 
-    static bool CompareEntries( const Entry<T>& a, const Entry<T>& b );
+    bool MultMetaMatchesPattern() const;
+    void RevalidateMultMeta();
+    void ExchangeStash();
 
     void EnsureConsistentSizes() const;
     void EnsureConsistentCapacities() const;
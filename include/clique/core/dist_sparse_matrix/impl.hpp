@@ -16,24 +16,30 @@ namespace cliq {
 template<typename T>
 inline 
 DistSparseMatrix<T>::DistSparseMatrix()
+: lowerStorage_(false), conjugateStorage_(false), frozenPattern_(false),
+  refilling_(false)
 { }
 
 template<typename T>
 inline 
 DistSparseMatrix<T>::DistSparseMatrix( mpi::Comm comm )
-: distGraph_(comm)
+: distGraph_(comm), lowerStorage_(false), conjugateStorage_(false),
+  frozenPattern_(false), refilling_(false)
 { }
 
 template<typename T>
 inline
 DistSparseMatrix<T>::DistSparseMatrix( int height, mpi::Comm comm )
-: distGraph_(height,comm)
+: distGraph_(height,comm), lowerStorage_(false), conjugateStorage_(false),
+  frozenPattern_(false), refilling_(false)
 { }
 
 template<typename T>
 inline 
 DistSparseMatrix<T>::DistSparseMatrix( int height, int width, mpi::Comm comm )
-: distGraph_(height,width,comm)
+: distGraph_(height,width,comm), 
+  lowerStorage_(false), conjugateStorage_(false), frozenPattern_(false),
+  refilling_(false)
 { }
 
 template<typename T>
@@ -65,8 +71,12 @@ template<typename T>
 inline void
 DistSparseMatrix<T>::SetComm( mpi::Comm comm )
 { 
+    multMeta.ready = false;
+    frozenPattern_ = false;
+    refilling_ = false;
     distGraph_.SetComm( comm ); 
     SwapClear( vals_ );
+    SwapClear( stash_ );
 }
 
 template<typename T>
@@ -156,11 +166,6 @@ DistSparseMatrix<T>::Value( int localInd ) const
     return vals_[localInd];
 }
 
-template<typename T>
-inline int*
-DistSparseMatrix<T>::SourceBuffer()
-{ return distGraph_.SourceBuffer(); }
-
 template<typename T>
 inline int*
 DistSparseMatrix<T>::TargetBuffer()
@@ -171,11 +176,6 @@ inline T*
 DistSparseMatrix<T>::ValueBuffer()
 { return &vals_[0]; }
 
-template<typename T>
-inline const int*
-DistSparseMatrix<T>::LockedSourceBuffer() const
-{ return distGraph_.LockedSourceBuffer(); }
-
 template<typename T>
 inline const int*
 DistSparseMatrix<T>::LockedTargetBuffer() const
@@ -187,20 +187,50 @@ DistSparseMatrix<T>::LockedValueBuffer() const
 { return &vals_[0]; }
 
 template<typename T>
-inline bool
-DistSparseMatrix<T>::CompareEntries( const Entry<T>& a, const Entry<T>& b )
+inline const int*
+DistSparseMatrix<T>::LockedOffsetBuffer() const
+{ return distGraph_.LockedOffsetBuffer(); }
+
+template<typename T>
+inline void
+DistSparseMatrix<T>::SetLowerStorage( bool lowerStorage, bool conjugate )
 {
-    return a.i < b.i || (a.i == b.i && a.j < b.j);
+    DEBUG_ONLY(CallStackEntry cse("DistSparseMatrix::SetLowerStorage"))
+    if( lowerStorage && Height() != Width() )
+        LogicError("Lower storage requires a square matrix");
+    if( distGraph_.NumLocalEdges() != 0 )
+        LogicError("Storage must be chosen before adding entries");
+    lowerStorage_ = lowerStorage;
+    conjugateStorage_ = ( lowerStorage && conjugate );
+    distGraph_.lowerStorage_ = lowerStorage;
 }
 
+template<typename T>
+inline bool
+DistSparseMatrix<T>::LowerStorage() const
+{ return lowerStorage_; }
+
+template<typename T>
+inline bool
+DistSparseMatrix<T>::ConjugateStorage() const
+{ return conjugateStorage_; }
+
 template<typename T>
 inline void
 DistSparseMatrix<T>::StartAssembly()
 {
     DEBUG_ONLY(CallStackEntry cse("DistSparseMatrix::StartAssembly"))
-    multMeta.ready = false;
-    distGraph_.EnsureNotAssembling();
-    distGraph_.assembling_ = true;
+    // With a frozen pattern, only the values are refilled (from scratch), and
+    // so the graph is left untouched
+    if( frozenPattern_ )
+    {
+        if( refilling_ )
+            LogicError("Already assembling");
+        refilling_ = true;
+        std::fill( vals_.begin(), vals_.end(), T(0) );
+    }
+    else
+        distGraph_.StartAssembly();
 }
 
 template<typename T>
@@ -208,51 +238,58 @@ inline void
 DistSparseMatrix<T>::StopAssembly()
 {
     DEBUG_ONLY(CallStackEntry cse("DistSparseMatrix::StopAssembly"))
-    if( !distGraph_.assembling_ )
+    if( !distGraph_.assembling_ && !refilling_ )
         LogicError("Cannot stop assembly without starting");
-    distGraph_.assembling_ = false;
+    // Route the updates of rows which we do not own to their owners
+    ExchangeStash();
 
-    // Ensure that the connection pairs are sorted
-    if( !distGraph_.sorted_ )
+    // A frozen pattern is already sorted and compressed, and all of the 
+    // metadata built upon it remains valid
+    if( frozenPattern_ )
     {
-        const int numLocalEntries = vals_.size();
-        std::vector<Entry<T> > entries( numLocalEntries );
-        for( int s=0; s<numLocalEntries; ++s )
-        {
-            entries[s].i = distGraph_.sources_[s];
-            entries[s].j = distGraph_.targets_[s];
-            entries[s].value = vals_[s];
-        }
-        std::sort( entries.begin(), entries.end(), CompareEntries );
+        refilling_ = false;
+        return;
+    }
+    distGraph_.assembling_ = false;
 
-        // Compress out duplicates
-        int lastUnique=0;
-        for( int s=1; s<numLocalEntries; ++s )
-        {
-            if( entries[s].i != entries[lastUnique].i ||
-                entries[s].j != entries[lastUnique].j )
-            {
-                ++lastUnique;
-                entries[lastUnique].i = entries[s].i;
-                entries[lastUnique].j = entries[s].j;
-                entries[lastUnique].value = entries[s].value;
-            }
-            else
-                entries[lastUnique].value += entries[s].value;
-        }
-        const int numUnique = lastUnique+1;
+    // Sort the entries and combine any updates to the same entry
+    SortAndCompressEdges
+    ( distGraph_.firstLocalSource_, distGraph_.numLocalSources_, 
+      distGraph_.sources_, distGraph_.targets_, &vals_, 
+      distGraph_.localEdgeOffsets_ );
+    distGraph_.sorted_ = true;
+    RevalidateMultMeta();
+}
 
-        distGraph_.sources_.resize( numUnique );
-        distGraph_.targets_.resize( numUnique );
-        vals_.resize( numUnique );
-        for( int s=0; s<numUnique; ++s )
+template<typename T>
+inline void
+DistSparseMatrix<T>::AdoptCSR
+( std::vector<int>& offsets, std::vector<int>& cols, std::vector<T>& vals )
+{
+    DEBUG_ONLY(CallStackEntry cse("DistSparseMatrix::AdoptCSR"))
+    if( frozenPattern_ )
+        LogicError("Cannot adopt a new pattern while it is frozen");
+    if( vals.size() != cols.size() )
+        LogicError("Expected one value per column index");
+    const int localHeight = LocalHeight();
+    if( (int)offsets.size() != localHeight+1 )
+        LogicError("Expected one offset per local row, plus one");
+    if( lowerStorage_ )
+    {
+        const int firstLocalRow = FirstLocalRow();
+        for( int iLocal=0; iLocal<localHeight; ++iLocal )
         {
-            distGraph_.sources_[s] = entries[s].i;
-            distGraph_.targets_[s] = entries[s].j;
-            vals_[s] = entries[s].value;
+            // The columns are sorted, so only the last one must be checked
+            const int end = offsets[iLocal+1];
+            if( end > offsets[iLocal] && cols[end-1] > firstLocalRow+iLocal )
+                LogicError("Lower storage requires a lower-triangular pattern");
         }
     }
-    distGraph_.ComputeLocalEdgeOffsets();
+    distGraph_.AdoptCSR( offsets, cols );
+    vals_.swap( vals );
+    SwapClear( vals );
+    SwapClear( stash_ );
+    RevalidateMultMeta();
 }
 
 template<typename T>
@@ -271,24 +308,242 @@ DistSparseMatrix<T>::Update( int row, int col, T value )
         CallStackEntry cse("DistSparseMatrix::Update");
         EnsureConsistentSizes();
     )
+    // The upper triangle is implied by the lower triangle
+    if( lowerStorage_ && col > row )
+        return;
+    const int firstLocalRow = FirstLocalRow();
+    if( row < firstLocalRow || row >= firstLocalRow+LocalHeight() )
+    {
+        DEBUG_ONLY(
+            if( row < 0 || row >= Height() )
+                LogicError("Row was out of bounds");
+            if( !distGraph_.assembling_ && !refilling_ )
+                LogicError("Must start assembly before updating");
+        )
+        Entry<T> entry;
+        entry.i = row;
+        entry.j = col;
+        entry.value = value;
+        stash_.push_back( entry );
+        return;
+    }
+    if( frozenPattern_ )
+    {
+        DEBUG_ONLY(
+            if( !refilling_ )
+                LogicError("Must start assembly before updating");
+        )
+        const int slot = Slot( row, col );
+        if( slot < 0 )
+            LogicError("Entry is not in the frozen sparsity pattern");
+        vals_[slot] += value;
+        return;
+    }
     distGraph_.Insert( row, col );
     vals_.push_back( value );
 }
 
+template<typename T>
+inline void
+DistSparseMatrix<T>::FreezePattern( bool freeze )
+{
+    DEBUG_ONLY(CallStackEntry cse("DistSparseMatrix::FreezePattern"))
+    if( distGraph_.assembling_ || refilling_ )
+        LogicError("Cannot change the pattern mode during assembly");
+    frozenPattern_ = freeze;
+}
+
+template<typename T>
+inline bool
+DistSparseMatrix<T>::FrozenPattern() const
+{ return frozenPattern_; }
+
+template<typename T>
+inline int
+DistSparseMatrix<T>::Slot( int row, int col ) const
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("DistSparseMatrix::Slot");
+        if( distGraph_.assembling_ )
+            LogicError("Slots are not available during unfrozen assembly");
+    )
+    const int iLocal = row - FirstLocalRow();
+    if( iLocal < 0 || iLocal >= LocalHeight() )
+        LogicError("Slots are only available for locally-owned rows");
+    const int* rowOffs = distGraph_.LockedOffsetBuffer();
+    const int* cols = distGraph_.LockedTargetBuffer();
+    const int* colsEnd = cols + rowOffs[iLocal+1];
+    const int* it = std::lower_bound( cols+rowOffs[iLocal], colsEnd, col );
+    if( it == colsEnd || *it != col )
+        return -1;
+    return it - cols;
+}
+
+template<typename T>
+inline void
+DistSparseMatrix<T>::UpdateSlot( int slot, T value )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("DistSparseMatrix::UpdateSlot");
+        if( slot < 0 || slot >= (int)vals_.size() )
+            LogicError("Slot out of bounds");
+        if( !refilling_ )
+            LogicError("Slot updates require a frozen pattern and assembly");
+    )
+    vals_[slot] += value;
+}
+
+template<typename T>
+inline void
+DistSparseMatrix<T>::ExchangeStash()
+{
+    DEBUG_ONLY(CallStackEntry cse("DistSparseMatrix::ExchangeStash"))
+    mpi::Comm comm = Comm();
+    const int commSize = mpi::CommSize( comm );
+    const int blocksize = Blocksize();
+
+    // Skip the exchange entirely (after a single reduction) if no process 
+    // stashed any updates, which is the common case
+    const int numStashed = stash_.size();
+    if( mpi::AllReduce( numStashed, mpi::MAX, comm ) == 0 )
+        return;
+
+    // Count the number of stashed updates for each process
+    std::vector<int> sendSizes( commSize, 0 );
+    for( int s=0; s<numStashed; ++s )
+        ++sendSizes[RowToProcess( stash_[s].i, blocksize, commSize )];
+    std::vector<int> recvSizes( commSize );
+    mpi::AllToAll( &sendSizes[0], 1, &recvSizes[0], 1, comm );
+    int numSends=0, numRecvs=0;
+    std::vector<int> sendOffs( commSize ), recvOffs( commSize );
+    for( int q=0; q<commSize; ++q )
+    {
+        sendOffs[q] = numSends;
+        recvOffs[q] = numRecvs;
+        numSends += sendSizes[q];
+        numRecvs += recvSizes[q];
+    }
+
+    // Pack the (i,j,value) triples by destination
+    std::vector<Entry<T> > sendEntries( numSends );
+    std::vector<int> offs = sendOffs;
+    for( int s=0; s<numStashed; ++s )
+    {
+        const int q = RowToProcess( stash_[s].i, blocksize, commSize );
+        sendEntries[offs[q]++] = stash_[s];
+    }
+    SwapClear( offs );
+    SwapClear( stash_ );
+
+    // Exchange the triples in a single (byte-wise) exchange
+    const int entrySize = sizeof(Entry<T>);
+    for( int q=0; q<commSize; ++q )
+    {
+        sendSizes[q] *= entrySize;
+        sendOffs[q] *= entrySize;
+        recvSizes[q] *= entrySize;
+        recvOffs[q] *= entrySize;
+    }
+    std::vector<Entry<T> > recvEntries( numRecvs );
+    mpi::AllToAll
+    ( (byte*)&sendEntries[0], &sendSizes[0], &sendOffs[0],
+      (byte*)&recvEntries[0], &recvSizes[0], &recvOffs[0], comm );
+    SwapClear( sendEntries );
+
+    if( frozenPattern_ )
+    {
+        for( int s=0; s<numRecvs; ++s )
+        {
+            const Entry<T>& entry = recvEntries[s];
+            const int slot = Slot( entry.i, entry.j );
+            if( slot < 0 )
+                LogicError("Entry is not in the frozen sparsity pattern");
+            vals_[slot] += entry.value;
+        }
+        return;
+    }
+
+    // Append the received updates so that they are combined with any local 
+    // updates of the same entries
+    Reserve( NumLocalEntries()+numRecvs );
+    for( int s=0; s<numRecvs; ++s )
+    {
+        distGraph_.Insert( recvEntries[s].i, recvEntries[s].j );
+        vals_.push_back( recvEntries[s].value );
+    }
+}
+
 template<typename T>
 inline void
 DistSparseMatrix<T>::Empty()
 {
+    multMeta.ready = false;
+    frozenPattern_ = false;
+    refilling_ = false;
     distGraph_.Empty();
     SwapClear( vals_ );
+    SwapClear( stash_ );
 }
 
 template<typename T>
 inline void
 DistSparseMatrix<T>::ResizeTo( int height, int width )
 {
+    if( height != Height() || width != Width() )
+        multMeta.ready = false;
+    frozenPattern_ = false;
+    refilling_ = false;
     distGraph_.ResizeTo( height, width );
     SwapClear( vals_ );
+    SwapClear( stash_ );
+}
+
+template<typename T>
+inline bool
+DistSparseMatrix<T>::MultMetaMatchesPattern() const
+{
+    DEBUG_ONLY(CallStackEntry cse("DistSparseMatrix::MultMetaMatchesPattern"))
+    const int localHeight = LocalHeight();
+    const int numLocalEntries = distGraph_.NumLocalEdges();
+    if( (int)multMeta.rowOffs.size() != localHeight+1 || 
+        (int)multMeta.colOffs.size() != numLocalEntries )
+        return false;
+    const int firstLocalRow = FirstLocalRow();
+    const int* rowOffs = distGraph_.LockedOffsetBuffer();
+    const int* cols = distGraph_.LockedTargetBuffer();
+    for( int iLocal=0; iLocal<localHeight; ++iLocal )
+    {
+        if( rowOffs[iLocal+1] != multMeta.rowOffs[iLocal+1] )
+            return false;
+        const int localBeg = multMeta.localBegs[iLocal];
+        const int localEnd = multMeta.localEnds[iLocal];
+        for( int k=rowOffs[iLocal]; k<rowOffs[iLocal+1]; ++k )
+        {
+            const int colOff = multMeta.colOffs[k];
+            const int j = 
+                ( k >= localBeg && k < localEnd ? firstLocalRow + colOff
+                                                : multMeta.recvInds[colOff] );
+            if( cols[k] != j )
+                return false;
+        }
+    }
+    return true;
+}
+
+template<typename T>
+inline void
+DistSparseMatrix<T>::RevalidateMultMeta()
+{
+    DEBUG_ONLY(CallStackEntry cse("DistSparseMatrix::RevalidateMultMeta"))
+    // Only throw away the multiplication metadata if the sparsity pattern
+    // changed on some process, as the communication pattern is shared
+    if( multMeta.ready )
+    {
+        const int localMatch = MultMetaMatchesPattern();
+        int match;
+        mpi::AllReduce( &localMatch, &match, 1, mpi::MIN, Comm() );
+        multMeta.ready = match;
+    }
 }
 
 template<typename T>
@@ -135,6 +135,17 @@ RelativeIndices( const std::vector<Int>& sub, const std::vector<Int>& full );
 
 Int RowToProcess( Int i, Int blocksize, Int commSize );
 
+// Sort a list of edges (and, if vals is nonzero, their values, which are 
+// stored contiguously in groups of valSize per edge, e.g., for dense blocks) 
+// in place by source and then target, combine duplicates (by summing their 
+// values), and compress the sources into the offsets of the edges of each of 
+// the numSources sources (the sources vector is freed)
+template<typename T>
+void SortAndCompressEdges
+( int firstSource, int numSources, 
+  std::vector<int>& sources, std::vector<int>& targets, std::vector<T>* vals,
+  std::vector<int>& offsets, int valSize=1 );
+
 Int Find
 ( const std::vector<Int>& sortedInds, Int index, 
   std::string msg="Could not find index" );
@@ -183,6 +183,178 @@ VerifySendsAndRecvs
     }
 }
 
+namespace internal {
+
+template<typename T>
+inline bool 
+CompareTargets( const std::pair<int,T>& a, const std::pair<int,T>& b )
+{ return a.first < b.first; }
+
+} // namespace internal
+
+template<typename T>
+inline void
+SortAndCompressEdges
+( int firstSource, int numSources, 
+  std::vector<int>& sources, std::vector<int>& targets, std::vector<T>* vals,
+  std::vector<int>& offsets, int valSize )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("SortAndCompressEdges");
+        if( vals != 0 && vals->size() != targets.size()*valSize )
+            LogicError("Inconsistent number of values");
+    )
+    const int numEdges = targets.size();
+
+    // Count the number of edges of each source
+    offsets.assign( numSources+1, 0 );
+    for( int e=0; e<numEdges; ++e )
+    {
+        const int s = sources[e] - firstSource;
+        DEBUG_ONLY(
+            if( s < 0 || s >= numSources )
+                LogicError("Source was out of bounds");
+        )
+        ++offsets[s+1];
+    }
+    for( int s=0; s<numSources; ++s )
+        offsets[s+1] += offsets[s];
+
+    // Bucket the edges by source in place by following cycles of the 
+    // permutation, so that the only workspace is one counter per source
+    std::vector<int> next( offsets.begin(), offsets.end()-1 );
+    for( int s=0; s<numSources; ++s )
+    {
+        while( next[s] < offsets[s+1] )
+        {
+            const int e = next[s];
+            const int sDest = sources[e] - firstSource;
+            if( sDest == s )
+            {
+                ++next[s];
+                continue;
+            }
+            const int eDest = next[sDest]++;
+            std::swap( sources[e], sources[eDest] );
+            std::swap( targets[e], targets[eDest] );
+            if( vals != 0 )
+                std::swap_ranges
+                ( vals->begin()+e*valSize, vals->begin()+(e+1)*valSize,
+                  vals->begin()+eDest*valSize );
+        }
+    }
+    SwapClear( next );
+
+    // Independently sort and compress the edges of each source
+    std::vector<int> numUnique( numSources );
+#ifdef HAVE_OPENMP
+    #pragma omp parallel
+#endif
+    {
+        std::vector<std::pair<int,T> > pairs;
+        std::vector<std::pair<int,int> > order;
+        std::vector<T> work;
+#ifdef HAVE_OPENMP
+        #pragma omp for schedule(dynamic,64)
+#endif
+        for( int s=0; s<numSources; ++s )
+        {
+            const int edgeBeg = offsets[s];
+            const int edgeEnd = offsets[s+1];
+            bool sorted = true;
+            for( int e=edgeBeg+1; e<edgeEnd; ++e )
+            {
+                if( targets[e] < targets[e-1] )
+                {
+                    sorted = false;
+                    break;
+                }
+            }
+            if( !sorted && vals == 0 )
+                std::sort( targets.begin()+edgeBeg, targets.begin()+edgeEnd );
+            else if( !sorted && valSize > 1 )
+            {
+                // Sort the positions so that each group of values is only 
+                // moved once
+                const int numEdgesSrc = edgeEnd - edgeBeg;
+                order.resize( numEdgesSrc );
+                for( int e=edgeBeg; e<edgeEnd; ++e )
+                    order[e-edgeBeg] = std::pair<int,int>( targets[e], e );
+                std::sort( order.begin(), order.end() );
+                work.resize( numEdgesSrc*valSize );
+                for( int k=0; k<numEdgesSrc; ++k )
+                {
+                    targets[edgeBeg+k] = order[k].first;
+                    std::copy
+                    ( vals->begin()+order[k].second*valSize,
+                      vals->begin()+(order[k].second+1)*valSize,
+                      work.begin()+k*valSize );
+                }
+                std::copy
+                ( work.begin(), work.end(), vals->begin()+edgeBeg*valSize );
+            }
+            else if( !sorted )
+            {
+                pairs.resize( edgeEnd-edgeBeg );
+                for( int e=edgeBeg; e<edgeEnd; ++e )
+                    pairs[e-edgeBeg] = 
+                        std::pair<int,T>( targets[e], (*vals)[e] );
+                std::sort
+                ( pairs.begin(), pairs.end(), internal::CompareTargets<T> );
+                for( int e=edgeBeg; e<edgeEnd; ++e )
+                {
+                    targets[e] = pairs[e-edgeBeg].first;
+                    (*vals)[e] = pairs[e-edgeBeg].second;
+                }
+            }
+
+            int lastUnique = edgeBeg;
+            for( int e=edgeBeg+1; e<edgeEnd; ++e )
+            {
+                if( targets[e] != targets[lastUnique] )
+                {
+                    ++lastUnique;
+                    targets[lastUnique] = targets[e];
+                    if( vals != 0 )
+                        for( int k=0; k<valSize; ++k )
+                            (*vals)[lastUnique*valSize+k] = 
+                                (*vals)[e*valSize+k];
+                }
+                else if( vals != 0 )
+                    for( int k=0; k<valSize; ++k )
+                        (*vals)[lastUnique*valSize+k] += (*vals)[e*valSize+k];
+            }
+            numUnique[s] = ( edgeEnd > edgeBeg ? lastUnique-edgeBeg+1 : 0 );
+        }
+    }
+
+    // Shift the compressed edges of each source into place
+    int numKept = 0;
+    for( int s=0; s<numSources; ++s )
+    {
+        const int edgeBeg = offsets[s];
+        if( edgeBeg != numKept )
+        {
+            for( int k=0; k<numUnique[s]; ++k )
+            {
+                targets[numKept+k] = targets[edgeBeg+k];
+                if( vals != 0 )
+                    for( int j=0; j<valSize; ++j )
+                        (*vals)[(numKept+k)*valSize+j] = 
+                            (*vals)[(edgeBeg+k)*valSize+j];
+            }
+        }
+        offsets[s] = numKept;
+        numKept += numUnique[s];
+    }
+    offsets[numSources] = numKept;
+    targets.resize( numKept );
+    if( vals != 0 )
+        vals->resize( numKept*valSize );
+    // The sources are now implied by the offsets
+    SwapClear( sources );
+}
+
 template<typename T>
 inline void
 SparseAllToAll
@@ -36,16 +36,20 @@ public:
     void Insert( int source, int target );
     int Capacity() const;
 
+    // Adopt the buffers of a graph in compressed sparse row (CSR) format, 
+    // where the targets of each source are strictly increasing. The input 
+    // buffers are swapped in (and the passed-in vectors are left empty).
+    void AdoptCSR( std::vector<int>& offsets, std::vector<int>& targets );
+
     // Data
     int NumEdges() const;
     int Source( int edge ) const;
     int Target( int edge ) const;
     int EdgeOffset( int source ) const;
     int NumConnections( int source ) const;
-    int* SourceBuffer();
     int* TargetBuffer();
-    const int* LockedSourceBuffer() const;
     const int* LockedTargetBuffer() const;
+    const int* LockedOffsetBuffer() const;
 
     // For resizing the graph
     void Empty();
@@ -59,15 +63,13 @@ public:
 
 private:
     int numSources_, numTargets_;
+    // The edges are stored in compressed sparse row format, and the source 
+    // of each edge is only explicitly stored during assembly
     std::vector<int> sources_, targets_;
+    std::vector<int> edgeOffsets_;
 
     // Helpers for local indexing
     bool assembling_, sorted_;
-    std::vector<int> edgeOffsets_;
-    void ComputeEdgeOffsets();
-
-    static bool ComparePairs
-    ( const std::pair<int,int>& a, const std::pair<int,int>& b );
 
     void EnsureNotAssembling() const;
     void EnsureConsistentSizes() const;
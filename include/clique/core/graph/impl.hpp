@@ -15,19 +15,20 @@ namespace cliq {
 
 inline 
 Graph::Graph()
-: numSources_(0), numTargets_(0), assembling_(false), sorted_(true)
+: numSources_(0), numTargets_(0), edgeOffsets_(1,0), 
+  assembling_(false), sorted_(true)
 { }
 
 inline 
 Graph::Graph( int numVertices )
 : numSources_(numVertices), numTargets_(numVertices), 
-  assembling_(false), sorted_(true)
+  edgeOffsets_(numVertices+1,0), assembling_(false), sorted_(true)
 { }
 
 inline 
 Graph::Graph( int numSources, int numTargets )
 : numSources_(numSources), numTargets_(numTargets),
-  assembling_(false), sorted_(true)
+  edgeOffsets_(numSources+1,0), assembling_(false), sorted_(true)
 { }
 
 inline
@@ -66,7 +67,7 @@ Graph::NumEdges() const
         CallStackEntry cse("Graph::NumEdges");
         EnsureConsistentSizes();
     )
-    return sources_.size();
+    return targets_.size();
 }
 
 inline int
@@ -77,7 +78,7 @@ Graph::Capacity() const
         EnsureConsistentSizes();
         EnsureConsistentCapacities();
     )
-    return sources_.capacity();
+    return targets_.capacity();
 }
 
 inline int
@@ -85,11 +86,14 @@ Graph::Source( int edge ) const
 {
     DEBUG_ONLY(
         CallStackEntry cse("Graph::Source");
-        if( edge < 0 || edge >= (int)sources_.size() )
+        if( edge < 0 || edge >= (int)targets_.size() )
             LogicError("Edge number out of bounds");
     )
     EnsureNotAssembling();
-    return sources_[edge];
+    // Only the offsets of the sources are stored, so search for the last 
+    // source whose edges begin at or before this edge
+    return std::upper_bound( edgeOffsets_.begin(), edgeOffsets_.end(), edge ) -
+           edgeOffsets_.begin() - 1;
 }
 
 inline int
@@ -130,22 +134,18 @@ Graph::NumConnections( int source ) const
     return EdgeOffset(source+1) - EdgeOffset(source);
 }
 
-inline int*
-Graph::SourceBuffer()
-{ return &sources_[0]; }
-
 inline int*
 Graph::TargetBuffer()
 { return &targets_[0]; }
 
-inline const int*
-Graph::LockedSourceBuffer() const
-{ return &sources_[0]; }
-
 inline const int*
 Graph::LockedTargetBuffer() const
 { return &targets_[0]; }
 
+inline const int*
+Graph::LockedOffsetBuffer() const
+{ return &edgeOffsets_[0]; }
+
 inline const Graph&
 Graph::operator=( const Graph& graph )
 {
@@ -182,17 +182,20 @@ Graph::operator=( const DistGraph& graph )
     return *this;
 }
 
-inline bool
-Graph::ComparePairs
-( const std::pair<int,int>& a, const std::pair<int,int>& b )
-{ return a.first < b.first || (a.first  == b.first && a.second < b.second); }
-
 inline void
 Graph::StartAssembly()
 {
     DEBUG_ONLY(CallStackEntry cse("Graph::StartAssembly"))
     EnsureNotAssembling();
     assembling_ = true;
+
+    // The source of each edge is only explicitly stored during assembly
+    const int numEdges = targets_.size();
+    sources_.reserve( targets_.capacity() );
+    sources_.resize( numEdges );
+    for( int s=0; s<numSources_; ++s )
+        for( int e=edgeOffsets_[s]; e<edgeOffsets_[s+1]; ++e )
+            sources_[e] = s;
 }
 
 inline void
@@ -203,60 +206,10 @@ Graph::StopAssembly()
         LogicError("Cannot stop assembly without starting");
     assembling_ = false;
 
-    // Ensure that the connection pairs are sorted
-    if( !sorted_ )
-    {
-        const int numEdges = sources_.size();
-        std::vector<std::pair<int,int> > pairs( numEdges );
-        for( int e=0; e<numEdges; ++e )
-        {
-            pairs[e].first = sources_[e];
-            pairs[e].second = targets_[e];
-        }
-        std::sort( pairs.begin(), pairs.end(), ComparePairs );
-
-        // Compress out duplicates
-        int lastUnique=0;
-        for( int e=1; e<numEdges; ++e )
-            if( pairs[e] != pairs[lastUnique] )
-                pairs[++lastUnique] = pairs[e];
-        const int numUnique = lastUnique+1;
-
-        sources_.resize( numUnique );
-        targets_.resize( numUnique );
-        for( int e=0; e<numUnique; ++e )
-        {
-            sources_[e] = pairs[e].first;
-            targets_[e] = pairs[e].second;
-        }
-    }
-
-    ComputeEdgeOffsets();
-}
-
-inline void
-Graph::ComputeEdgeOffsets()
-{
-    DEBUG_ONLY(CallStackEntry cse("Graph::ComputeEdgeOffsets"))
-    // Compute the edge offsets
-    int sourceOffset = 0;
-    int prevSource = -1;
-    edgeOffsets_.resize( numSources_+1 );
-    const int numEdges = NumEdges();
-    for( int edge=0; edge<numEdges; ++edge )
-    {
-        const int source = Source( edge );
-        DEBUG_ONLY(
-            if( source < prevSource )
-                RuntimeError("sources were not properly sorted");
-        )
-        while( source != prevSource )
-        {
-            edgeOffsets_[sourceOffset++] = edge;
-            ++prevSource;
-        }
-    }
-    edgeOffsets_[numSources_] = numEdges;
+    // Sort the connection pairs and remove any duplicates
+    SortAndCompressEdges<int>
+    ( 0, numSources_, sources_, targets_, 0, edgeOffsets_ );
+    sorted_ = true;
 }
 
 inline void
@@ -298,6 +251,39 @@ Graph::Insert( int source, int target )
     targets_.push_back( target );
 }
 
+inline void
+Graph::AdoptCSR( std::vector<int>& offsets, std::vector<int>& targets )
+{
+    DEBUG_ONLY(CallStackEntry cse("Graph::AdoptCSR"))
+    EnsureNotAssembling();
+    if( (int)offsets.size() != numSources_+1 )
+        LogicError("Expected one offset per source, plus one");
+    if( offsets[0] != 0 || offsets[numSources_] != (int)targets.size() )
+        LogicError("Offsets did not match the number of targets");
+    // Since the targets of each source must already be strictly increasing,
+    // a single pass suffices in place of sorting and compression
+    for( int s=0; s<numSources_; ++s )
+    {
+        const int edgeBeg = offsets[s];
+        const int edgeEnd = offsets[s+1];
+        if( edgeEnd < edgeBeg )
+            LogicError("Offsets must be non-decreasing");
+        for( int e=edgeBeg; e<edgeEnd; ++e )
+        {
+            if( targets[e] < 0 || targets[e] >= numTargets_ )
+                LogicError("Target was out of bounds");
+            if( e > edgeBeg && targets[e] <= targets[e-1] )
+                LogicError("Targets of each source must strictly increase");
+        }
+    }
+    edgeOffsets_.swap( offsets );
+    targets_.swap( targets );
+    SwapClear( offsets );
+    SwapClear( targets );
+    SwapClear( sources_ );
+    sorted_ = true;
+}
+
 inline void
 Graph::Empty()
 {
@@ -307,7 +293,7 @@ Graph::Empty()
     SwapClear( targets_ );
     sorted_ = true;
     assembling_ = false;
-    SwapClear( edgeOffsets_ );
+    edgeOffsets_.assign( 1, 0 );
 }
 
 inline void
@@ -323,7 +309,7 @@ Graph::ResizeTo( int numSources, int numTargets )
     SwapClear( targets_ );
     sorted_ = true;
     assembling_ = false;
-    SwapClear( edgeOffsets_ );
+    edgeOffsets_.assign( numSources+1, 0 );
 }
 
 inline void
@@ -336,14 +322,16 @@ Graph::EnsureNotAssembling() const
 inline void
 Graph::EnsureConsistentSizes() const
 { 
-    if( sources_.size() != targets_.size() )
+    if( assembling_ && sources_.size() != targets_.size() )
         LogicError("Inconsistent graph sizes");
+    if( !assembling_ && edgeOffsets_[numSources_] != (int)targets_.size() )
+        LogicError("Inconsistent graph offsets");
 }
 
 inline void
 Graph::EnsureConsistentCapacities() const
 { 
-    if( sources_.capacity() != targets_.capacity() )
+    if( assembling_ && sources_.capacity() != targets_.capacity() )
         LogicError("Inconsistent graph capacities");
 }
 
@@ -39,6 +39,11 @@ public:
     void Update( int row, int col, T value );
     int Capacity() const;
 
+    // Adopt CSR buffers (with strictly increasing columns within each row) 
+    // without any sorting or per-entry insertion
+    void AdoptCSR
+    ( std::vector<int>& offsets, std::vector<int>& cols, std::vector<T>& vals );
+
     // Data
     int Row( int index ) const;
     int Col( int index ) const;
@@ -46,12 +51,11 @@ public:
     int NumEntries() const;
     int EntryOffset( int row ) const;
     int NumConnections( int row ) const;
-    int* SourceBuffer();
     int* TargetBuffer();
     T* ValueBuffer();
-    const int* LockedSourceBuffer() const;
     const int* LockedTargetBuffer() const;
     const T* LockedValueBuffer() const;
+    const int* LockedOffsetBuffer() const;
 
     // For modifying the size of the matrix
     void Empty();
@@ -66,8 +70,6 @@ private:
     cliq::Graph graph_;
     std::vector<T> vals_;
 
-    static bool CompareEntries( const Entry<T>& a, const Entry<T>& b );
-
     void EnsureConsistentSizes() const;
     void EnsureConsistentCapacities() const;
 
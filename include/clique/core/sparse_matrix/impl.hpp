@@ -141,11 +141,6 @@ SparseMatrix<T>::Value( int index ) const
     return vals_[index];
 }
 
-template<typename T>
-inline int*
-SparseMatrix<T>::SourceBuffer()
-{ return graph_.SourceBuffer(); }
-
 template<typename T>
 inline int*
 SparseMatrix<T>::TargetBuffer()
@@ -156,11 +151,6 @@ inline T*
 SparseMatrix<T>::ValueBuffer()
 { return &vals_[0]; }
 
-template<typename T>
-inline const int*
-SparseMatrix<T>::LockedSourceBuffer() const
-{ return graph_.LockedSourceBuffer(); }
-
 template<typename T>
 inline const int*
 SparseMatrix<T>::LockedTargetBuffer() const
@@ -172,17 +162,16 @@ SparseMatrix<T>::LockedValueBuffer() const
 { return &vals_[0]; }
 
 template<typename T>
-inline bool
-SparseMatrix<T>::CompareEntries( const Entry<T>& a, const Entry<T>& b )
-{ return a.i < b.i || (a.i == b.i && a.j < b.j); }
+inline const int*
+SparseMatrix<T>::LockedOffsetBuffer() const
+{ return graph_.LockedOffsetBuffer(); }
 
 template<typename T>
 inline void
 SparseMatrix<T>::StartAssembly()
 {
     DEBUG_ONLY(CallStackEntry cse("SparseMatrix::StartAssembly"))
-    graph_.EnsureNotAssembling();
-    graph_.assembling_ = true;
+    graph_.StartAssembly();
 }
 
 template<typename T>
@@ -194,47 +183,11 @@ SparseMatrix<T>::StopAssembly()
         LogicError("Cannot stop assembly without starting");
     graph_.assembling_ = false;
 
-    // Ensure that the connection pairs are sorted
-    if( !graph_.sorted_ )
-    {
-        const int numEntries = vals_.size();
-        std::vector<Entry<T> > entries( numEntries );
-        for( int s=0; s<numEntries; ++s )
-        {
-            entries[s].i = graph_.sources_[s];
-            entries[s].j = graph_.targets_[s];
-            entries[s].value = vals_[s];
-        }
-        std::sort( entries.begin(), entries.end(), CompareEntries );
-
-        // Compress out duplicates
-        int lastUnique=0;
-        for( int s=1; s<numEntries; ++s )
-        {
-            if( entries[s].i != entries[lastUnique].i ||
-                entries[s].j != entries[lastUnique].j )
-            {
-                ++lastUnique;
-                entries[lastUnique].i = entries[s].i;
-                entries[lastUnique].j = entries[s].j;
-                entries[lastUnique].value = entries[s].value;
-            }
-            else
-                entries[lastUnique].value += entries[s].value;
-        }
-        const int numUnique = lastUnique+1;
-
-        graph_.sources_.resize( numUnique );
-        graph_.targets_.resize( numUnique );
-        vals_.resize( numUnique );
-        for( int s=0; s<numUnique; ++s )
-        {
-            graph_.sources_[s] = entries[s].i;
-            graph_.targets_[s] = entries[s].j;
-            vals_[s] = entries[s].value;
-        }
-    }
-    graph_.ComputeEdgeOffsets();
+    // Sort the entries and combine any updates to the same entry
+    SortAndCompressEdges
+    ( 0, graph_.numSources_, graph_.sources_, graph_.targets_, &vals_, 
+      graph_.edgeOffsets_ );
+    graph_.sorted_ = true;
 }
 
 template<typename T>
@@ -257,6 +210,19 @@ SparseMatrix<T>::Update( int row, int col, T value )
     vals_.push_back( value );
 }
 
+template<typename T>
+inline void
+SparseMatrix<T>::AdoptCSR
+( std::vector<int>& offsets, std::vector<int>& cols, std::vector<T>& vals )
+{
+    DEBUG_ONLY(CallStackEntry cse("SparseMatrix::AdoptCSR"))
+    if( vals.size() != cols.size() )
+        LogicError("Expected one value per column index");
+    graph_.AdoptCSR( offsets, cols );
+    vals_.swap( vals );
+    SwapClear( vals );
+}
+
 template<typename T>
 inline void
 SparseMatrix<T>::Empty()
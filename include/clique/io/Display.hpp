@@ -49,11 +49,11 @@ Display( const Graph& graph, std::string title )
     const int n = graph.NumSources();
     elem::Zeros( *graphMat, m, n );
 
-    const int numEdges = graph.NumEdges();
-    const int* srcBuf = graph.LockedSourceBuffer();
+    const int* offBuf = graph.LockedOffsetBuffer();
     const int* tgtBuf = graph.LockedTargetBuffer();
-    for( int e=0; e<numEdges; ++e )
-        graphMat->Set( tgtBuf[e], srcBuf[e], 1 );
+    for( int s=0; s<n; ++s )
+        for( int e=offBuf[s]; e<offBuf[s+1]; ++e )
+            graphMat->Set( tgtBuf[e], s, 1 );
 
     QString qTitle = QString::fromStdString( title );
     elem::SpyWindow* spyWindow = new elem::SpyWindow;
@@ -92,8 +92,10 @@ Display( const DistGraph& graph, std::string title )
         sources.resize( numEdges );
         targets.resize( numEdges );
     }
+    std::vector<int> localSources;
+    internal::ExpandLocalSources( graph, localSources );
     mpi::Gather
-    ( graph.LockedSourceBuffer(), numLocalEdges,
+    ( &localSources[0], numLocalEdges,
       &sources[0], &edgeSizes[0], &edgeOffsets[0], 0, comm );
     mpi::Gather
     ( graph.LockedTargetBuffer(), numLocalEdges,
@@ -132,12 +134,12 @@ Display( const SparseMatrix<T>& A, std::string title )
     const int n = A.Width();
     elem::Zeros( *AFull, m, n );
 
-    const int numEntries = A.NumEntries();
-    const int* srcBuf = A.LockedSourceBuffer();
+    const int* offBuf = A.LockedOffsetBuffer();
     const int* tgtBuf = A.LockedTargetBuffer();
     const T* valBuf = A.LockedValueBuffer();
-    for( int s=0; s<numEntries; ++s )
-        AFull->Set( tgtBuf[s], srcBuf[s], double(valBuf[s]) );
+    for( int i=0; i<m; ++i )
+        for( int s=offBuf[i]; s<offBuf[i+1]; ++s )
+            AFull->Set( tgtBuf[s], i, double(valBuf[s]) );
 
     QString qTitle = QString::fromStdString( title );
     elem::DisplayWindow* displayWindow = new elem::DisplayWindow;
@@ -162,15 +164,17 @@ Display( const SparseMatrix<Complex<T> >& A, std::string title )
     const int n = A.Width();
     elem::Zeros( *AFull, m, n );
 
-    const int numEntries = A.NumEntries();
-    const int* srcBuf = A.LockedSourceBuffer();
+    const int* offBuf = A.LockedOffsetBuffer();
     const int* tgtBuf = A.LockedTargetBuffer();
     const Complex<T>* valBuf = A.LockedValueBuffer();
-    for( int s=0; s<numEntries; ++s )
+    for( int i=0; i<m; ++i )
     {
-        const Complex<double> alpha = 
-            Complex<double>(valBuf[s].real,valBuf[s].imag);
-        AFull->Set( tgtBuf[s], srcBuf[s], alpha );
+        for( int s=offBuf[i]; s<offBuf[i+1]; ++s )
+        {
+            const Complex<double> alpha = 
+                Complex<double>(valBuf[s].real,valBuf[s].imag);
+            AFull->Set( tgtBuf[s], i, alpha );
+        }
     }
 
     QString qTitle = QString::fromStdString( title );
@@ -213,8 +217,10 @@ Display( const DistSparseMatrix<T>& A, std::string title )
         targets.resize( numNonzeros );
         values.resize( numNonzeros );
     }
+    std::vector<int> localSources;
+    internal::ExpandLocalSources( A.LockedDistGraph(), localSources );
     mpi::Gather
-    ( A.LockedSourceBuffer(), numLocalEntries,
+    ( &localSources[0], numLocalEntries,
       &sources[0], &nonzeroSizes[0], &nonzeroOffsets[0], 0, comm );
     mpi::Gather
     ( A.LockedTargetBuffer(), numLocalEntries,
@@ -274,8 +280,10 @@ Display( const DistSparseMatrix<Complex<T> >& A, std::string title )
         targets.resize( numNonzeros );
         values.resize( numNonzeros );
     }
+    std::vector<int> localSources;
+    internal::ExpandLocalSources( A.LockedDistGraph(), localSources );
     mpi::Gather
-    ( A.LockedSourceBuffer(), numLocalEntries,
+    ( &localSources[0], numLocalEntries,
       &sources[0], &nonzeroSizes[0], &nonzeroOffsets[0], 0, comm );
     mpi::Gather
     ( A.LockedTargetBuffer(), numLocalEntries,
@@ -34,17 +34,36 @@ void PrintLocal( const DistSymmInfo& info, std::ostream& os=std::cout );
 // Implementation begins here
 //
 
+namespace internal {
+
+// Since only the offsets of the sources are stored, the source of each local 
+// edge must be expanded before it can be gathered
+inline void
+ExpandLocalSources( const DistGraph& graph, std::vector<int>& sources )
+{
+    const int firstLocalSource = graph.FirstLocalSource();
+    const int numLocalSources = graph.NumLocalSources();
+    const int* offsets = graph.LockedOffsetBuffer();
+    sources.resize( graph.NumLocalEdges() );
+    for( int s=0; s<numLocalSources; ++s )
+        for( int e=offsets[s]; e<offsets[s+1]; ++e )
+            sources[e] = firstLocalSource + s;
+}
+
+} // namespace internal
+
 inline void
 Print( const Graph& graph, std::string msg, std::ostream& os )
 {
     DEBUG_ONLY(CallStackEntry cse("Print [Graph]"))
     if( msg != "" )
         os << msg << std::endl;
-    const int numEdges = graph.NumEdges();
-    const int* srcBuf = graph.LockedSourceBuffer();
+    const int numSources = graph.NumSources();
+    const int* offBuf = graph.LockedOffsetBuffer();
     const int* tgtBuf = graph.LockedTargetBuffer();
-    for( int e=0; e<numEdges; ++e )
-        os << srcBuf[e] << " " << tgtBuf[e] << "\n";
+    for( int s=0; s<numSources; ++s )
+        for( int e=offBuf[s]; e<offBuf[s+1]; ++e )
+            os << s << " " << tgtBuf[e] << "\n";
     os << std::endl;
 }
 
@@ -72,8 +91,10 @@ Print( const DistGraph& graph, std::string msg, std::ostream& os )
         sources.resize( numEdges );
         targets.resize( numEdges );
     }
+    std::vector<int> localSources;
+    internal::ExpandLocalSources( graph, localSources );
     mpi::Gather
-    ( graph.LockedSourceBuffer(), numLocalEdges,
+    ( &localSources[0], numLocalEdges,
       &sources[0], &edgeSizes[0], &edgeOffsets[0], 0, comm );
     mpi::Gather
     ( graph.LockedTargetBuffer(), numLocalEdges,
@@ -96,12 +117,13 @@ Print( const SparseMatrix<T>& A, std::string msg, std::ostream& os )
     DEBUG_ONLY(CallStackEntry cse("Print [SparseMatrix]"))
     if( msg != "" )
         os << msg << std::endl;
-    const int numEntries = A.NumEntries();
-    const int* srcBuf = A.LockedSourceBuffer();
+    const int height = A.Height();
+    const int* offBuf = A.LockedOffsetBuffer();
     const int* tgtBuf = A.LockedTargetBuffer();
     const T* valBuf = A.LockedValueBuffer();
-    for( int s=0; s<numEntries; ++s )
-        os << srcBuf[s] << " " << tgtBuf[s] << " " << valBuf[s] << "\n";
+    for( int i=0; i<height; ++i )
+        for( int s=offBuf[i]; s<offBuf[i+1]; ++s )
+            os << i << " " << tgtBuf[s] << " " << valBuf[s] << "\n";
     os << std::endl;
 }
 
@@ -132,8 +154,10 @@ Print( const DistSparseMatrix<T>& A, std::string msg, std::ostream& os )
         targets.resize( numNonzeros );
         values.resize( numNonzeros );
     }
+    std::vector<int> localSources;
+    internal::ExpandLocalSources( A.LockedDistGraph(), localSources );
     mpi::Gather
-    ( A.LockedSourceBuffer(), numLocalEntries,
+    ( &localSources[0], numLocalEntries,
       &sources[0], &nonzeroSizes[0], &nonzeroOffsets[0], 0, comm );
     mpi::Gather
     ( A.LockedTargetBuffer(), numLocalEntries,
@@ -77,7 +77,17 @@ inline void ChangeFrontType( DistSymmFrontTree<F>& L, SymmFrontType frontType )
         // We must perform selective inversion with a 2D distribution
         if( FrontsAre1d(oldFrontType) )
             ChangeFrontType( L, ConvertTo2d(oldFrontType) );
-        // Perform selective inversion
+        // Perform selective inversion on the local fronts (which includes
+        // the distributed leaf, as it is attached to the local root)
+        const int numLocalNodes = L.localFronts.size();
+        for( int s=0; s<numLocalNodes; ++s )
+        {
+            SymmFront<F>& front = L.localFronts[s];
+            const int snSize = front.frontL.Width();
+            auto LT = View( front.frontL, 0, 0, snSize, snSize );
+            elem::TriangularInverse( LOWER, UNIT, LT );
+        }
+        // Perform selective inversion on the distributed fronts
         for( int s=1; s<numDistNodes; ++s )
         {
             // Invert the unit-diagonal lower triangle
@@ -13,6 +13,27 @@
 
 namespace cliq {
 
+// Metadata for redistributing between the 1d distribution of a DistMultiVec
+// and the [VC,* ] distributions over the elimination tree. It only depends 
+// upon the inverse map and the symbolic information, so it may be reused for
+// any number of redistributions of any width.
+struct NodalRedistMeta
+{
+    bool ready;
+    int numOwnerInds, numNodalInds;
+    std::vector<int> ownerSizes, ownerOffs,
+                     nodalSizes, nodalOffs;
+    // The local rows of the DistMultiVec in the order of the exchange buffer
+    std::vector<int> ownerInds;
+    // The exchange buffer position of each of our rows of the nodal vectors
+    std::vector<int> nodalInds;
+
+    NodalRedistMeta() : ready(false) { }
+};
+
+void ComputeNodalRedistMeta
+( const DistMap& inverseMap, const DistSymmInfo& info, NodalRedistMeta& meta );
+
 // For handling a set of vectors distributed in a [VC,* ] manner over each node
 // of the elimination tree
 template<typename F>
@@ -26,6 +47,9 @@ public:
     DistNodalMultiVec
     ( const DistMap& inverseMap, const DistSymmInfo& info,
       const DistMultiVec<F>& X );
+    DistNodalMultiVec
+    ( const NodalRedistMeta& meta, const DistSymmInfo& info,
+      const DistMultiVec<F>& X );
     DistNodalMultiVec( const DistNodalMatrix<F>& X );
 
     const DistNodalMultiVec<F>& operator=( const DistNodalMatrix<F>& X );
@@ -37,6 +61,17 @@ public:
     ( const DistMap& inverseMap, const DistSymmInfo& info,
             DistMultiVec<F>& X ) const;
 
+    // Redistribute using precomputed metadata (see ComputeNodalRedistMeta)
+    void Pull
+    ( const NodalRedistMeta& meta, const DistSymmInfo& info,
+      const DistMultiVec<F>& X );
+    void Push
+    ( const NodalRedistMeta& meta, const DistSymmInfo& info,
+            DistMultiVec<F>& X ) const;
+
+    // Form uninitialized nodal vectors conforming to the elimination tree
+    void ResizeTo( const DistSymmInfo& info, int width );
+
     int Height() const;
     int Width() const;
 
@@ -45,6 +80,26 @@ private:
     int height_, width_;
 };
 
+// Set all of the entries of X to zero
+template<typename T>
+void MakeZeros( DistNodalMultiVec<T>& X );
+
+// Draw the entries of X uniformly from the unitball in T
+template<typename T>
+void MakeUniform( DistNodalMultiVec<T>& X );
+
+// Just column-wise l2 norms for now
+template<typename F>
+void Norms( const DistNodalMultiVec<F>& X, std::vector<BASE(F)>& norms );
+
+// Simplification for case where there is only one column
+template<typename F>
+BASE(F) Norm( const DistNodalMultiVec<F>& x );
+
+// Y := alpha X + Y
+template<typename T>
+void Axpy( T alpha, const DistNodalMultiVec<T>& X, DistNodalMultiVec<T>& Y );
+
 } // namespace cliq
 
 #endif // ifndef CLIQ_NUMERIC_DISTNODALMULTIVEC_DECL_HPP
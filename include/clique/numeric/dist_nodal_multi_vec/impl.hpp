@@ -13,6 +13,261 @@
 
 namespace cliq {
 
+inline void
+ComputeNodalRedistMeta
+( const DistMap& inverseMap, const DistSymmInfo& info, NodalRedistMeta& meta )
+{
+    DEBUG_ONLY(CallStackEntry cse("ComputeNodalRedistMeta"))
+    const DistSymmNodeInfo& rootNode = info.distNodes.back();
+    mpi::Comm comm = rootNode.comm;
+    const int height = rootNode.size + rootNode.off;
+    const int commSize = mpi::CommSize( comm );
+    const int commRank = mpi::CommRank( comm );
+    const int blocksize = height / commSize;
+    const int firstLocalRow = commRank*blocksize;
+
+    // Traverse our part of the elimination tree to see how many indices we need
+    int numNodalInds=0;
+    const int numLocal = info.localNodes.size();
+    for( int s=0; s<numLocal; ++s )
+        numNodalInds += info.localNodes[s].size;
+    const int numDist = info.distNodes.size();
+    for( int s=1; s<numDist; ++s )
+        numNodalInds += info.distNodes[s].multiVecMeta.localSize;
+    
+    // Fill the set of indices that we need to map to the original ordering
+    int off=0;
+    std::vector<int> mappedInds( numNodalInds );
+    for( int s=0; s<numLocal; ++s )
+    {
+        const SymmNodeInfo& nodeInfo = info.localNodes[s];
+        for( int t=0; t<nodeInfo.size; ++t )
+            mappedInds[off++] = nodeInfo.off+t;
+    }
+    for( int s=1; s<numDist; ++s )
+    {
+        const DistSymmNodeInfo& nodeInfo = info.distNodes[s];
+        const Grid& grid = *nodeInfo.grid;
+        const int gridSize = grid.Size();
+        const int gridRank = grid.VCRank();
+        const int alignment = 0;
+        const int shift = Shift( gridRank, alignment, gridSize );
+        for( int t=shift; t<nodeInfo.size; t+=gridSize )
+            mappedInds[off++] = nodeInfo.off+t;
+    }
+    DEBUG_ONLY(
+        if( off != numNodalInds )
+            LogicError("mappedInds was filled incorrectly");
+    )
+
+    // Convert the indices to the original ordering
+    inverseMap.Translate( mappedInds );
+
+    // Figure out how many entries each process owns that we need
+    meta.numNodalInds = numNodalInds;
+    meta.nodalSizes.resize( commSize );
+    meta.nodalOffs.resize( commSize );
+    std::fill( meta.nodalSizes.begin(), meta.nodalSizes.end(), 0 );
+    for( int s=0; s<numNodalInds; ++s )
+    {
+        const int i = mappedInds[s];
+        const int q = RowToProcess( i, blocksize, commSize );
+        ++meta.nodalSizes[q];
+    }
+    off=0;
+    for( int q=0; q<commSize; ++q )
+    {
+        meta.nodalOffs[q] = off;
+        off += meta.nodalSizes[q];
+    }
+
+    // Store the buffer position of each of our nodal rows and pack the 
+    // corresponding original indices
+    meta.nodalInds.resize( numNodalInds );
+    std::vector<int> nodalRows( numNodalInds );
+    std::vector<int> offs = meta.nodalOffs;
+    for( int s=0; s<numNodalInds; ++s )
+    {
+        const int i = mappedInds[s];
+        const int q = RowToProcess( i, blocksize, commSize );
+        meta.nodalInds[s] = offs[q];
+        nodalRows[offs[q]++] = i;
+    }
+    SwapClear( mappedInds );
+    SwapClear( offs );
+
+    // Coordinate for the coming AllToAll to exchange the indices
+    meta.ownerSizes.resize( commSize );
+    meta.ownerOffs.resize( commSize );
+    mpi::AllToAll
+    ( &meta.nodalSizes[0], 1, &meta.ownerSizes[0], 1, comm );
+    int numOwnerInds=0;
+    for( int q=0; q<commSize; ++q )
+    {
+        meta.ownerOffs[q] = numOwnerInds;
+        numOwnerInds += meta.ownerSizes[q];
+    }
+    meta.numOwnerInds = numOwnerInds;
+
+    // Exchange the indices (once) and convert them into local rows
+    meta.ownerInds.resize( numOwnerInds );
+    mpi::AllToAll
+    ( &nodalRows[0], &meta.nodalSizes[0], &meta.nodalOffs[0],
+      &meta.ownerInds[0], &meta.ownerSizes[0], &meta.ownerOffs[0], comm );
+    for( int s=0; s<numOwnerInds; ++s )
+    {
+        meta.ownerInds[s] -= firstLocalRow;
+        DEBUG_ONLY(
+            const int iLocal = meta.ownerInds[s];
+            if( iLocal < 0 || 
+                iLocal >= ( commRank==commSize-1 ? 
+                            height-firstLocalRow : blocksize ) )
+                LogicError("Requested row was not locally owned");
+        )
+    }
+
+    meta.ready = true;
+}
+
+template<typename T>
+inline void
+MakeZeros( DistNodalMultiVec<T>& X )
+{
+    DEBUG_ONLY(CallStackEntry cse("MakeZeros"))
+    const int numLocal = X.localNodes.size();
+    const int numDist = X.distNodes.size();
+    for( int s=0; s<numLocal; ++s )
+        elem::MakeZeros( X.localNodes[s] );
+    for( int s=0; s<numDist; ++s )
+        elem::MakeZeros( X.distNodes[s] );
+}
+
+template<typename T>
+inline void
+MakeUniform( DistNodalMultiVec<T>& X )
+{
+    DEBUG_ONLY(CallStackEntry cse("MakeUniform"))
+    const int numLocal = X.localNodes.size();
+    const int numDist = X.distNodes.size();
+    const int width = X.Width();
+    for( int s=0; s<numLocal+numDist; ++s )
+    {
+        Matrix<T>& XNode = 
+            ( s<numLocal ? X.localNodes[s] : X.distNodes[s-numLocal].Matrix() );
+        const int localHeight = XNode.Height();
+        for( int j=0; j<width; ++j )
+            for( int iLocal=0; iLocal<localHeight; ++iLocal )
+                XNode.Set( iLocal, j, elem::SampleBall<T>() );
+    }
+}
+
+template<typename F>
+inline void
+Norms( const DistNodalMultiVec<F>& X, std::vector<BASE(F)>& norms )
+{
+    DEBUG_ONLY(CallStackEntry cse("Norms"))
+    typedef BASE(F) R;
+    const int numLocal = X.localNodes.size();
+    const int numDist = X.distNodes.size();
+    const int width = X.Width();
+    // The root separator is distributed over the entire team
+    mpi::Comm comm = 
+        ( numDist != 0 ? X.distNodes.back().Grid().VCComm() : mpi::COMM_SELF );
+
+    norms.resize( width );
+    std::vector<R> localScales( width, 0 ), 
+                   localScaledSquares( width, 1 );
+    for( int s=0; s<numLocal+numDist; ++s )
+    {
+        const Matrix<F>& XNode = 
+            ( s<numLocal ? X.localNodes[s] 
+                         : X.distNodes[s-numLocal].LockedMatrix() );
+        const int localHeight = XNode.Height();
+        for( int j=0; j<width; ++j )
+        {
+            R& localScale = localScales[j];
+            R& localScaledSquare = localScaledSquares[j];
+            for( int iLocal=0; iLocal<localHeight; ++iLocal )
+            {
+                const R alphaAbs = Abs(XNode.Get(iLocal,j));
+                if( alphaAbs != 0 )
+                {
+                    if( alphaAbs <= localScale )
+                    {
+                        const R relScale = alphaAbs/localScale;
+                        localScaledSquare += relScale*relScale;
+                    }
+                    else
+                    {
+                        const R relScale = localScale/alphaAbs;
+                        localScaledSquare = 
+                            localScaledSquare*relScale*relScale + 1;
+                        localScale = alphaAbs;
+                    }
+                }
+            }
+        }
+    }
+
+    // Find the maximum relative scales
+    std::vector<R> scales( width );
+    mpi::AllReduce( &localScales[0], &scales[0], width, mpi::MAX, comm );
+
+    // Equilibrate the local scaled sums
+    for( int j=0; j<width; ++j )
+    {
+        const R scale = scales[j];
+        if( scale != 0 )
+        {
+            // Equilibrate our local scaled sum to the maximum scale
+            R relScale = localScales[j]/scale;
+            localScaledSquares[j] *= relScale*relScale;
+        }
+        else
+            localScaledSquares[j] = 0;
+    }
+
+    // Combine the local contributions
+    std::vector<R> scaledSquares( width );
+    mpi::AllReduce
+    ( &localScaledSquares[0], &scaledSquares[0], width, mpi::SUM, comm );
+    for( int j=0; j<width; ++j )
+        norms[j] = scales[j]*Sqrt(scaledSquares[j]);
+}
+
+template<typename F>
+inline BASE(F)
+Norm( const DistNodalMultiVec<F>& x )
+{
+    DEBUG_ONLY(CallStackEntry cse("Norm"))
+    if( x.Width() != 1 )
+        LogicError("Norm only applies when there is one column");
+    typedef BASE(F) R;
+    std::vector<R> norms;
+    Norms( x, norms );
+    return norms[0];
+}
+
+template<typename T>
+inline void
+Axpy( T alpha, const DistNodalMultiVec<T>& X, DistNodalMultiVec<T>& Y )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("Axpy");
+        if( X.Height() != Y.Height() || X.Width() != Y.Width() )
+            LogicError("X and Y must be the same size");
+        if( X.localNodes.size() != Y.localNodes.size() || 
+            X.distNodes.size() != Y.distNodes.size() )
+            LogicError("X and Y must have the same nodal structure");
+    )
+    const int numLocal = X.localNodes.size();
+    const int numDist = X.distNodes.size();
+    for( int s=0; s<numLocal; ++s )
+        elem::Axpy( alpha, X.localNodes[s], Y.localNodes[s] );
+    for( int s=0; s<numDist; ++s )
+        elem::Axpy( alpha, X.distNodes[s], Y.distNodes[s] );
+}
+
 template<typename F>
 inline
 DistNodalMultiVec<F>::DistNodalMultiVec()
@@ -29,6 +284,16 @@ DistNodalMultiVec<F>::DistNodalMultiVec
     Pull( inverseMap, info, X );
 }
 
+template<typename F>
+inline
+DistNodalMultiVec<F>::DistNodalMultiVec
+( const NodalRedistMeta& meta, const DistSymmInfo& info,
+  const DistMultiVec<F>& X )
+{
+    DEBUG_ONLY(CallStackEntry cse("DistNodalMultiVec::DistNodalMultiVec"))
+    Pull( meta, info, X );
+}
+
 template<typename F>
 inline
 DistNodalMultiVec<F>::DistNodalMultiVec( const DistNodalMatrix<F>& X )
@@ -70,116 +335,57 @@ DistNodalMultiVec<F>::Pull
   const DistMultiVec<F>& X )
 {
     DEBUG_ONLY(CallStackEntry cse("DistNodalMultiVec::Pull"))
-    height_ = X.Height();
-    width_ = X.Width();
+    NodalRedistMeta meta;
+    ComputeNodalRedistMeta( inverseMap, info, meta );
+    Pull( meta, info, X );
+}
 
-    // Traverse our part of the elimination tree to see how many indices we need
-    int numRecvInds=0;
-    const int numLocal = info.localNodes.size();
-    for( int s=0; s<numLocal; ++s )
-        numRecvInds += info.localNodes[s].size;
-    const int numDist = info.distNodes.size();
-    for( int s=1; s<numDist; ++s )
-        numRecvInds += info.distNodes[s].multiVecMeta.localSize;
-    
-    // Fill the set of indices that we need to map to the original ordering
-    int off=0;
-    std::vector<int> mappedInds( numRecvInds );
-    for( int s=0; s<numLocal; ++s )
-    {
-        const SymmNodeInfo& nodeInfo = info.localNodes[s];
-        for( int t=0; t<nodeInfo.size; ++t )
-            mappedInds[off++] = nodeInfo.off+t;
-    }
-    for( int s=1; s<numDist; ++s )
-    {
-        const DistSymmNodeInfo& nodeInfo = info.distNodes[s];
-        const Grid& grid = *nodeInfo.grid;
-        const int gridSize = grid.Size();
-        const int gridRank = grid.VCRank();
-        const int alignment = 0;
-        const int shift = Shift( gridRank, alignment, gridSize );
-        for( int t=shift; t<nodeInfo.size; t+=gridSize )
-            mappedInds[off++] = nodeInfo.off+t;
-    }
+template<typename F>
+inline void
+DistNodalMultiVec<F>::Pull
+( const NodalRedistMeta& meta, const DistSymmInfo& info,
+  const DistMultiVec<F>& X )
+{
     DEBUG_ONLY(
-        if( off != numRecvInds )
-            LogicError("mappedInds was filled incorrectly");
+        CallStackEntry cse("DistNodalMultiVec::Pull");
+        if( !meta.ready )
+            LogicError("Redistribution metadata was not computed");
+        if( meta.numOwnerInds != X.LocalHeight() )
+            LogicError("Metadata does not match the local height of X");
     )
+    height_ = X.Height();
+    width_ = X.Width();
 
-    // Convert the indices to the original ordering
-    inverseMap.Translate( mappedInds );
-
-    // Figure out how many entries each process owns that we need
+    // Pack and send the values with a single exchange
     mpi::Comm comm = X.Comm();
     const int commSize = mpi::CommSize( comm );
-    std::vector<int> recvSizes( commSize, 0 );
-    const int blocksize = X.Blocksize();
-    for( int s=0; s<numRecvInds; ++s )
-    {
-        const int i = mappedInds[s];
-        const int q = RowToProcess( i, blocksize, commSize );
-        ++recvSizes[q];
-    }
-    std::vector<int> recvOffs( commSize );
-    off=0;
-    for( int q=0; q<commSize; ++q )
-    {
-        recvOffs[q] = off;
-        off += recvSizes[q];
-    }
-    std::vector<int> recvInds( numRecvInds );
-    std::vector<int> offs = recvOffs;
-    for( int s=0; s<numRecvInds; ++s )
+    const int numOwnerInds = meta.numOwnerInds;
+    std::vector<F> sendVals( numOwnerInds*width_ );
+    for( int s=0; s<numOwnerInds; ++s )
     {
-        const int i = mappedInds[s];
-        const int q = RowToProcess( i, blocksize, commSize );
-        recvInds[offs[q]++] = i;
-    }
-
-    // Coordinate for the coming AllToAll to exchange the indices of X
-    std::vector<int> sendSizes( commSize );
-    mpi::AllToAll( &recvSizes[0], 1, &sendSizes[0], 1, comm );
-    int numSendInds=0;
-    std::vector<int> sendOffs( commSize );
-    for( int q=0; q<commSize; ++q )
-    {
-        sendOffs[q] = numSendInds;
-        numSendInds += sendSizes[q];
-    }
-
-    // Request the indices
-    std::vector<int> sendInds( numSendInds );
-    mpi::AllToAll
-    ( &recvInds[0], &recvSizes[0], &recvOffs[0],
-      &sendInds[0], &sendSizes[0], &sendOffs[0], comm );
-
-    // Fulfill the requests
-    std::vector<F> sendVals( numSendInds*width_ );
-    const int firstLocalRow = X.FirstLocalRow();
-    for( int s=0; s<numSendInds; ++s )
+        const int iLocal = meta.ownerInds[s];
         for( int j=0; j<width_; ++j )
-            sendVals[s*width_+j] = X.GetLocal( sendInds[s]-firstLocalRow, j );
-
-    // Reply with the values
-    std::vector<F> recvVals( numRecvInds*width_ );
+            sendVals[s*width_+j] = X.GetLocal( iLocal, j );
+    }
+    std::vector<int> sendSizes( commSize ), sendOffs( commSize ),
+                     recvSizes( commSize ), recvOffs( commSize );
     for( int q=0; q<commSize; ++q )
     {
-        sendSizes[q] *= width_;
-        sendOffs[q] *= width_;
-        recvSizes[q] *= width_;
-        recvOffs[q] *= width_;
+        sendSizes[q] = meta.ownerSizes[q]*width_;
+        sendOffs[q] = meta.ownerOffs[q]*width_;
+        recvSizes[q] = meta.nodalSizes[q]*width_;
+        recvOffs[q] = meta.nodalOffs[q]*width_;
     }
+    std::vector<F> recvVals( meta.numNodalInds*width_ );
     mpi::AllToAll
     ( &sendVals[0], &sendSizes[0], &sendOffs[0],
       &recvVals[0], &recvSizes[0], &recvOffs[0], comm );
     SwapClear( sendVals );
-    SwapClear( sendSizes );
-    SwapClear( sendOffs );
 
     // Unpack the values
-    off = 0;
-    offs = recvOffs;
+    int off = 0;
+    const int numLocal = info.localNodes.size();
+    const int numDist = info.distNodes.size();
     localNodes.resize( numLocal );
     for( int s=0; s<numLocal; ++s )
     {
@@ -187,10 +393,9 @@ DistNodalMultiVec<F>::Pull
         localNodes[s].ResizeTo( nodeInfo.size, width_ );
         for( int t=0; t<nodeInfo.size; ++t )
         {
-            const int i = mappedInds[off++];
-            const int q = RowToProcess( i, blocksize, commSize );
+            const F* recvRow = &recvVals[meta.nodalInds[off++]*width_];
             for( int j=0; j<width_; ++j )
-                localNodes[s].Set( t, j, recvVals[offs[q]++] );
+                localNodes[s].Set( t, j, recvRow[j] );
         }
     }
     distNodes.resize( numDist-1 );
@@ -203,14 +408,13 @@ DistNodalMultiVec<F>::Pull
         const int localHeight = XNode.LocalHeight();
         for( int tLoc=0; tLoc<localHeight; ++tLoc )
         {
-            const int i = mappedInds[off++];
-            const int q = RowToProcess( i, blocksize, commSize );
+            const F* recvRow = &recvVals[meta.nodalInds[off++]*width_];
             for( int j=0; j<width_; ++j )
-                XNode.SetLocal( tLoc, j, recvVals[offs[q]++] );
+                XNode.SetLocal( tLoc, j, recvRow[j] );
         }
     }
     DEBUG_ONLY(
-        if( off != numRecvInds )
+        if( off != meta.numNodalInds )
             LogicError("Unpacked wrong number of indices");
     )
 }
@@ -222,71 +426,50 @@ DistNodalMultiVec<F>::Push
         DistMultiVec<F>& X ) const
 {
     DEBUG_ONLY(CallStackEntry cse("DistNodalMultiVec::Push"))
+    NodalRedistMeta meta;
+    ComputeNodalRedistMeta( inverseMap, info, meta );
+    Push( meta, info, X );
+}
+
+template<typename F>
+inline void
+DistNodalMultiVec<F>::Push
+( const NodalRedistMeta& meta, const DistSymmInfo& info,
+        DistMultiVec<F>& X ) const
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("DistNodalMultiVec::Push");
+        if( !meta.ready )
+            LogicError("Redistribution metadata was not computed");
+        if( meta.numNodalInds != LocalHeight() )
+            LogicError("Metadata does not match the nodal local height");
+    )
     const DistSymmNodeInfo& rootNode = info.distNodes.back();
     mpi::Comm comm = rootNode.comm;
     const int height = rootNode.size + rootNode.off;
     const int width = Width();
     X.SetComm( comm );
     X.ResizeTo( height, width );
+    DEBUG_ONLY(
+        if( meta.numOwnerInds != X.LocalHeight() )
+            LogicError("Metadata does not match the local height of X");
+    )
 
     const int commSize = mpi::CommSize( comm );
-    const int blocksize = X.Blocksize();
-    const int firstLocalRow = X.FirstLocalRow();
     const int numDist = info.distNodes.size();
     const int numLocal = info.localNodes.size();
 
-    // Fill the set of indices that we need to map to the original ordering
-    const int numSendInds = LocalHeight();
+    // Pack the values directly into their exchange buffer positions
     int off=0;
-    std::vector<int> mappedInds( numSendInds );
-    for( int s=0; s<numLocal; ++s )
-    {
-        const SymmNodeInfo& nodeInfo = info.localNodes[s];
-        for( int t=0; t<nodeInfo.size; ++t )
-            mappedInds[off++] = nodeInfo.off+t;
-    }
-    for( int s=1; s<numDist; ++s )
-    {
-        const DistSymmNodeInfo& nodeInfo = info.distNodes[s];
-        const DistMatrix<F,VC,STAR>& XNode = distNodes[s-1];
-        for( int t=XNode.ColShift(); t<XNode.Height(); t+=XNode.ColStride() )
-            mappedInds[off++] = nodeInfo.off+t;
-    }
-
-    // Convert the indices to the original ordering
-    inverseMap.Translate( mappedInds );
-
-    // Figure out how many indices each process owns that we need to send
-    std::vector<int> sendSizes( commSize, 0 );
-    for( int s=0; s<numSendInds; ++s )
-    {
-        const int i = mappedInds[s];
-        const int q = RowToProcess( i, blocksize, commSize );
-        ++sendSizes[q];
-    }
-    std::vector<int> sendOffs( commSize );
-    off=0;
-    for( int q=0; q<commSize; ++q )
-    {
-        sendOffs[q] = off;
-        off += sendSizes[q];
-    }
-
-    // Pack the send indices and values
-    off=0;
-    std::vector<F> sendVals( numSendInds*width );
-    std::vector<int> sendInds( numSendInds );
-    std::vector<int> offs = sendOffs;
+    std::vector<F> sendVals( meta.numNodalInds*width );
     for( int s=0; s<numLocal; ++s )
     {
         const SymmNodeInfo& nodeInfo = info.localNodes[s];
         for( int t=0; t<nodeInfo.size; ++t )
         {
-            const int i = mappedInds[off++];
-            const int q = RowToProcess( i, blocksize, commSize );
+            F* sendRow = &sendVals[meta.nodalInds[off++]*width];
             for( int j=0; j<width; ++j )
-                sendVals[offs[q]*width+j] = localNodes[s].Get(t,j);    
-            sendInds[offs[q]++] = i;
+                sendRow[j] = localNodes[s].Get(t,j);
         }
     }
     for( int s=1; s<numDist; ++s )
@@ -295,65 +478,61 @@ DistNodalMultiVec<F>::Push
         const int localHeight = XNode.LocalHeight();
         for( int tLoc=0; tLoc<localHeight; ++tLoc )
         {
-            const int i = mappedInds[off++];
-            const int q = RowToProcess( i, blocksize, commSize );
+            F* sendRow = &sendVals[meta.nodalInds[off++]*width];
             for( int j=0; j<width; ++j )
-                sendVals[offs[q]*width+j] = XNode.GetLocal(tLoc,j);
-            sendInds[offs[q]++] = i;
+                sendRow[j] = XNode.GetLocal(tLoc,j);
         }
     }
 
-    // Coordinate for the coming AllToAll to exchange the indices of x
-    std::vector<int> recvSizes( commSize );
-    mpi::AllToAll( &sendSizes[0], 1, &recvSizes[0], 1, comm );
-    int numRecvInds=0;
-    std::vector<int> recvOffs( commSize );
-    for( int q=0; q<commSize; ++q )
-    {
-        recvOffs[q] = numRecvInds;
-        numRecvInds += recvSizes[q];
-    }
-    DEBUG_ONLY(
-        if( numRecvInds != X.LocalHeight() )
-            LogicError("numRecvInds was not equal to local height");
-    )
-
-    // Send the indices
-    std::vector<int> recvInds( numRecvInds );
-    mpi::AllToAll
-    ( &sendInds[0], &sendSizes[0], &sendOffs[0],
-      &recvInds[0], &recvSizes[0], &recvOffs[0], comm );
-
-    // Send the values
-    std::vector<F> recvVals( numRecvInds*width );
+    // Send the values with a single exchange
+    std::vector<int> sendSizes( commSize ), sendOffs( commSize ),
+                     recvSizes( commSize ), recvOffs( commSize );
     for( int q=0; q<commSize; ++q )
     {
-        sendSizes[q] *= width;
-        sendOffs[q] *= width;
-        recvSizes[q] *= width;
-        recvOffs[q] *= width;
+        sendSizes[q] = meta.nodalSizes[q]*width;
+        sendOffs[q] = meta.nodalOffs[q]*width;
+        recvSizes[q] = meta.ownerSizes[q]*width;
+        recvOffs[q] = meta.ownerOffs[q]*width;
     }
+    const int numOwnerInds = meta.numOwnerInds;
+    std::vector<F> recvVals( numOwnerInds*width );
     mpi::AllToAll
     ( &sendVals[0], &sendSizes[0], &sendOffs[0],
       &recvVals[0], &recvSizes[0], &recvOffs[0], comm );
     SwapClear( sendVals );
-    SwapClear( sendSizes );
-    SwapClear( sendOffs );
 
     // Unpack the values
-    for( int s=0; s<numRecvInds; ++s )
+    for( int s=0; s<numOwnerInds; ++s )
     {
-        const int i = recvInds[s];
-        const int iLocal = i - firstLocalRow;
-        DEBUG_ONLY(
-            if( iLocal < 0 || iLocal >= X.LocalHeight() )
-                LogicError("iLocal was out of bounds");
-        )
+        const int iLocal = meta.ownerInds[s];
         for( int j=0; j<width; ++j )
             X.SetLocal( iLocal, j, recvVals[s*width+j] );
     }
 }
 
+template<typename F>
+inline void
+DistNodalMultiVec<F>::ResizeTo( const DistSymmInfo& info, int width )
+{
+    DEBUG_ONLY(CallStackEntry cse("DistNodalMultiVec::ResizeTo"))
+    const DistSymmNodeInfo& rootNode = info.distNodes.back();
+    height_ = rootNode.size + rootNode.off;
+    width_ = width;
+
+    const int numLocal = info.localNodes.size();
+    const int numDist = info.distNodes.size();
+    localNodes.resize( numLocal );
+    for( int s=0; s<numLocal; ++s )
+        localNodes[s].ResizeTo( info.localNodes[s].size, width );
+    distNodes.resize( numDist-1 );
+    for( int s=1; s<numDist; ++s )
+    {
+        const DistSymmNodeInfo& nodeInfo = info.distNodes[s];
+        distNodes[s-1].SetGrid( *nodeInfo.grid );
+        distNodes[s-1].ResizeTo( nodeInfo.size, width );
+    }
+}
+
 template<typename F>
 inline int
 DistNodalMultiVec<F>::Height() const
@@ -0,0 +1,68 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, and Stanford University
+   All rights reserved.
+ 
+   This file is part of Clique and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef CLIQ_NUMERIC_DISTNODALSPARSEMATRIX_DECL_HPP
+#define CLIQ_NUMERIC_DISTNODALSPARSEMATRIX_DECL_HPP
+
+namespace cliq {
+
+// The rows of a DistSparseMatrix, permuted into the nested dissection ordering
+// and redistributed to match the layout of DistNodalMultiVec, so that 
+// products with nodal vectors do not require a Pull/Push. The column indices
+// are kept in the original ordering.
+template<typename T>
+class DistNodalSparseMatrix
+{
+public:
+    DistNodalSparseMatrix();
+    DistNodalSparseMatrix
+    ( const DistMap& inverseMap, const DistSymmInfo& info,
+      const DistSparseMatrix<T>& A );
+    DistNodalSparseMatrix
+    ( const NodalRedistMeta& meta, const DistSymmInfo& info,
+      const DistSparseMatrix<T>& A );
+
+    void Pull
+    ( const DistMap& inverseMap, const DistSymmInfo& info,
+      const DistSparseMatrix<T>& A );
+    void Pull
+    ( const NodalRedistMeta& meta, const DistSymmInfo& info,
+      const DistSparseMatrix<T>& A );
+
+    // High-level information
+    int Height() const;
+    int Width() const;
+    mpi::Comm Comm() const;
+
+    // Local data (with rows in the local ordering of DistNodalMultiVec). 
+    // Within each row, the entries whose columns are owned by this process 
+    // in the nodal distribution come first.
+    int LocalHeight() const;
+    int NumLocalEntries() const;
+    int LocalEntryOffset( int localRow ) const;
+    int NumConnections( int localRow ) const;
+    int Col( int localInd ) const;
+    T Value( int localInd ) const;
+    const T* LockedValueBuffer() const;
+
+    // The send indices refer to the local rows of DistNodalMultiVec
+    SparseMultMeta<T> multMeta;
+
+private:
+    int height_, width_;
+    mpi::Comm comm_;
+
+    std::vector<int> rowOffs_, cols_;
+    std::vector<T> vals_;
+};
+
+} // namespace cliq
+
+#endif // ifndef CLIQ_NUMERIC_DISTNODALSPARSEMATRIX_DECL_HPP
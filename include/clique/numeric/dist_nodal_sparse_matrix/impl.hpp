@@ -0,0 +1,403 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, and Stanford University
+   All rights reserved.
+ 
+   This file is part of Clique and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef CLIQ_NUMERIC_DISTNODALSPARSEMATRIX_IMPL_HPP
+#define CLIQ_NUMERIC_DISTNODALSPARSEMATRIX_IMPL_HPP
+
+namespace cliq {
+
+template<typename T>
+inline
+DistNodalSparseMatrix<T>::DistNodalSparseMatrix()
+: height_(0), width_(0), comm_(mpi::COMM_WORLD)
+{ rowOffs_.resize( 1, 0 ); }
+
+template<typename T>
+inline
+DistNodalSparseMatrix<T>::DistNodalSparseMatrix
+( const DistMap& inverseMap, const DistSymmInfo& info,
+  const DistSparseMatrix<T>& A )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("DistNodalSparseMatrix::DistNodalSparseMatrix")
+    )
+    Pull( inverseMap, info, A );
+}
+
+template<typename T>
+inline
+DistNodalSparseMatrix<T>::DistNodalSparseMatrix
+( const NodalRedistMeta& meta, const DistSymmInfo& info,
+  const DistSparseMatrix<T>& A )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("DistNodalSparseMatrix::DistNodalSparseMatrix")
+    )
+    Pull( meta, info, A );
+}
+
+template<typename T>
+inline void
+DistNodalSparseMatrix<T>::Pull
+( const DistMap& inverseMap, const DistSymmInfo& info,
+  const DistSparseMatrix<T>& A )
+{
+    DEBUG_ONLY(CallStackEntry cse("DistNodalSparseMatrix::Pull"))
+    NodalRedistMeta meta;
+    ComputeNodalRedistMeta( inverseMap, info, meta );
+    Pull( meta, info, A );
+}
+
+template<typename T>
+inline void
+DistNodalSparseMatrix<T>::Pull
+( const NodalRedistMeta& meta, const DistSymmInfo& info,
+  const DistSparseMatrix<T>& A )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("DistNodalSparseMatrix::Pull");
+        if( !meta.ready )
+            LogicError("Redistribution metadata was not computed");
+        if( meta.numOwnerInds != A.LocalHeight() )
+            LogicError("Metadata does not match the local height of A");
+        if( A.Height() != A.Width() )
+            LogicError("A must be square");
+    )
+    if( A.LowerStorage() )
+        LogicError("Lower storage is not yet supported for nodal matrices");
+    height_ = A.Height();
+    width_ = A.Width();
+    comm_ = info.distNodes.back().comm;
+    const int commSize = mpi::CommSize( comm_ );
+    const int blocksize = A.Blocksize();
+    const int firstLocalRow = A.FirstLocalRow();
+    const int numOwnerInds = meta.numOwnerInds;
+    const int numNodalInds = meta.numNodalInds;
+
+    // Send the length of each requested row
+    std::vector<int> sendLengths( numOwnerInds );
+    for( int s=0; s<numOwnerInds; ++s )
+        sendLengths[s] = A.NumConnections( meta.ownerInds[s] );
+    std::vector<int> recvLengths( numNodalInds );
+    mpi::AllToAll
+    ( &sendLengths[0], &meta.ownerSizes[0], &meta.ownerOffs[0],
+      &recvLengths[0], &meta.nodalSizes[0], &meta.nodalOffs[0], comm_ );
+
+    // Pack the column indices and values of the requested rows
+    int numSendEntries=0;
+    std::vector<int> sendEntrySizes( commSize, 0 ), sendEntryOffs( commSize );
+    for( int q=0; q<commSize; ++q )
+    {
+        sendEntryOffs[q] = numSendEntries;
+        const int size = meta.ownerSizes[q];
+        const int off = meta.ownerOffs[q];
+        for( int s=0; s<size; ++s )
+            sendEntrySizes[q] += sendLengths[s+off];
+        numSendEntries += sendEntrySizes[q];
+    }
+    std::vector<int> sendCols( numSendEntries );
+    std::vector<T> sendVals( numSendEntries );
+    int index=0;
+    for( int s=0; s<numOwnerInds; ++s )
+    {
+        const int localEntryOff = A.LocalEntryOffset( meta.ownerInds[s] );
+        for( int t=0; t<sendLengths[s]; ++t )
+        {
+            sendCols[index] = A.Col( localEntryOff+t );
+            sendVals[index] = A.Value( localEntryOff+t );
+            ++index;
+        }
+    }
+    SwapClear( sendLengths );
+
+    // Receive the rows (in the order of the exchange buffer)
+    int numRecvEntries=0;
+    std::vector<int> recvEntrySizes( commSize, 0 ), recvEntryOffs( commSize );
+    for( int q=0; q<commSize; ++q )
+    {
+        recvEntryOffs[q] = numRecvEntries;
+        const int size = meta.nodalSizes[q];
+        const int off = meta.nodalOffs[q];
+        for( int s=0; s<size; ++s )
+            recvEntrySizes[q] += recvLengths[s+off];
+        numRecvEntries += recvEntrySizes[q];
+    }
+    std::vector<int> recvCols( numRecvEntries );
+    std::vector<T> recvVals( numRecvEntries );
+    mpi::AllToAll
+    ( &sendCols[0], &sendEntrySizes[0], &sendEntryOffs[0],
+      &recvCols[0], &recvEntrySizes[0], &recvEntryOffs[0], comm_ );
+    mpi::AllToAll
+    ( &sendVals[0], &sendEntrySizes[0], &sendEntryOffs[0],
+      &recvVals[0], &recvEntrySizes[0], &recvEntryOffs[0], comm_ );
+    SwapClear( sendCols );
+    SwapClear( sendVals );
+
+    // Store the rows in the nodal ordering
+    std::vector<int> bufferOffs( numNodalInds );
+    index = 0;
+    for( int s=0; s<numNodalInds; ++s )
+    {
+        bufferOffs[s] = index;
+        index += recvLengths[s];
+    }
+    rowOffs_.resize( numNodalInds+1 );
+    rowOffs_[0] = 0;
+    for( int iLocal=0; iLocal<numNodalInds; ++iLocal )
+        rowOffs_[iLocal+1] = 
+            rowOffs_[iLocal] + recvLengths[meta.nodalInds[iLocal]];
+    const int numLocalEntries = rowOffs_[numNodalInds];
+    cols_.resize( numLocalEntries );
+    vals_.resize( numLocalEntries );
+    for( int iLocal=0; iLocal<numNodalInds; ++iLocal )
+    {
+        const int s = meta.nodalInds[iLocal];
+        const int recvOff = bufferOffs[s];
+        const int rowOff = rowOffs_[iLocal];
+        for( int t=0; t<recvLengths[s]; ++t )
+        {
+            cols_[rowOff+t] = recvCols[recvOff+t];
+            vals_[rowOff+t] = recvVals[recvOff+t];
+        }
+    }
+    SwapClear( bufferOffs );
+    SwapClear( recvLengths );
+    SwapClear( recvCols );
+    SwapClear( recvVals );
+
+    // Inform the owner of each row where it lives in the nodal distribution
+    std::vector<int> sendNodalInds( numNodalInds );
+    for( int iLocal=0; iLocal<numNodalInds; ++iLocal )
+        sendNodalInds[meta.nodalInds[iLocal]] = iLocal;
+    std::vector<int> recvNodalInds( numOwnerInds );
+    mpi::AllToAll
+    ( &sendNodalInds[0], &meta.nodalSizes[0], &meta.nodalOffs[0],
+      &recvNodalInds[0], &meta.ownerSizes[0], &meta.ownerOffs[0], comm_ );
+    SwapClear( sendNodalInds );
+    std::vector<int> nodalOwners( numOwnerInds ), nodalRows( numOwnerInds );
+    for( int q=0; q<commSize; ++q )
+    {
+        const int size = meta.ownerSizes[q];
+        const int off = meta.ownerOffs[q];
+        for( int s=off; s<off+size; ++s )
+        {
+            const int iLocal = meta.ownerInds[s];
+            nodalOwners[iLocal] = q;
+            nodalRows[iLocal] = recvNodalInds[s];
+        }
+    }
+    SwapClear( recvNodalInds );
+
+    // Find the unique set of columns that we need and ask their (original)
+    // owners where they live in the nodal distribution
+    std::vector<int> recvInds = cols_;
+    std::sort( recvInds.begin(), recvInds.end() );
+    recvInds.erase
+    ( std::unique( recvInds.begin(), recvInds.end() ), recvInds.end() );
+    const int numRecvInds = recvInds.size();
+    std::vector<int> querySizes( commSize, 0 ), queryOffs( commSize );
+    for( int s=0; s<numRecvInds; ++s )
+        ++querySizes[RowToProcess( recvInds[s], blocksize, commSize )];
+    index = 0;
+    for( int q=0; q<commSize; ++q )
+    {
+        queryOffs[q] = index;
+        index += querySizes[q];
+    }
+    std::vector<int> answerSizes( commSize ), answerOffs( commSize );
+    mpi::AllToAll( &querySizes[0], 1, &answerSizes[0], 1, comm_ );
+    int numAnswers=0;
+    for( int q=0; q<commSize; ++q )
+    {
+        answerOffs[q] = numAnswers;
+        numAnswers += answerSizes[q];
+    }
+    std::vector<int> queries( numAnswers );
+    mpi::AllToAll
+    ( &recvInds[0], &querySizes[0], &queryOffs[0],
+      &queries[0],  &answerSizes[0], &answerOffs[0], comm_ );
+    for( int s=0; s<numAnswers; ++s )
+        queries[s] = nodalOwners[queries[s]-firstLocalRow];
+    std::vector<int> colOwners( numRecvInds );
+    mpi::AllToAll
+    ( &queries[0],   &answerSizes[0], &answerOffs[0], 
+      &colOwners[0], &querySizes[0],  &queryOffs[0], comm_ );
+    mpi::AllToAll
+    ( &recvInds[0], &querySizes[0], &queryOffs[0],
+      &queries[0],  &answerSizes[0], &answerOffs[0], comm_ );
+    for( int s=0; s<numAnswers; ++s )
+        queries[s] = nodalRows[queries[s]-firstLocalRow];
+    std::vector<int> colRows( numRecvInds );
+    mpi::AllToAll
+    ( &queries[0],  &answerSizes[0], &answerOffs[0], 
+      &colRows[0],  &querySizes[0],  &queryOffs[0], comm_ );
+    SwapClear( queries );
+    SwapClear( nodalOwners );
+    SwapClear( nodalRows );
+
+    // Form the exchange pattern for multiplication. The columns which we 
+    // own in the nodal distribution are read directly from our rows of X, 
+    // so only the remaining (ghost) columns are exchanged.
+    const int commRank = mpi::CommRank( comm_ );
+    multMeta.recvSizes.resize( commSize );
+    multMeta.recvOffs.resize( commSize );
+    std::fill( multMeta.recvSizes.begin(), multMeta.recvSizes.end(), 0 );
+    for( int s=0; s<numRecvInds; ++s )
+        if( colOwners[s] != commRank )
+            ++multMeta.recvSizes[colOwners[s]];
+    index = 0;
+    for( int q=0; q<commSize; ++q )
+    {
+        multMeta.recvOffs[q] = index;
+        index += multMeta.recvSizes[q];
+    }
+    const int numGhostInds = index;
+    std::vector<int> recvOffsets( numRecvInds ), requests( numGhostInds );
+    std::vector<bool> ownedCol( numRecvInds );
+    std::vector<int> offs = multMeta.recvOffs;
+    for( int s=0; s<numRecvInds; ++s )
+    {
+        const int q = colOwners[s];
+        ownedCol[s] = ( q == commRank );
+        if( ownedCol[s] )
+            recvOffsets[s] = colRows[s];
+        else
+        {
+            recvOffsets[s] = offs[q];
+            requests[offs[q]++] = colRows[s];
+        }
+    }
+    SwapClear( colOwners );
+    SwapClear( colRows );
+    multMeta.sendSizes.resize( commSize );
+    multMeta.sendOffs.resize( commSize );
+    mpi::AllToAll
+    ( &multMeta.recvSizes[0], 1, &multMeta.sendSizes[0], 1, comm_ );
+    int numSendInds=0;
+    for( int q=0; q<commSize; ++q )
+    {
+        multMeta.sendOffs[q] = numSendInds;
+        numSendInds += multMeta.sendSizes[q];
+    }
+    multMeta.sendInds.resize( numSendInds );
+    mpi::AllToAll
+    ( &requests[0],           &multMeta.recvSizes[0], &multMeta.recvOffs[0],
+      &multMeta.sendInds[0], &multMeta.sendSizes[0], &multMeta.sendOffs[0], 
+      comm_ );
+
+    // Reorder the entries of each row so that those with owned columns come
+    // first, and record the boundary so that they can be applied while the
+    // ghost values are in flight
+    multMeta.colOffs.resize( numLocalEntries );
+    multMeta.rowOffs = rowOffs_;
+    multMeta.localBegs.resize( numNodalInds );
+    multMeta.localEnds.resize( numNodalInds );
+    std::vector<int> rowCols, rowColOffs;
+    std::vector<T> rowVals;
+    for( int iLocal=0; iLocal<numNodalInds; ++iLocal )
+    {
+        const int rowOff = rowOffs_[iLocal];
+        const int rowSize = rowOffs_[iLocal+1] - rowOff;
+        rowCols.resize( rowSize );
+        rowColOffs.resize( rowSize );
+        rowVals.resize( rowSize );
+        int numPlaced = 0;
+        for( int pass=0; pass<2; ++pass )
+        {
+            for( int t=0; t<rowSize; ++t )
+            {
+                const int e = rowOff + t;
+                const int s = Find( recvInds, cols_[e] );
+                if( ownedCol[s] != ( pass == 0 ) )
+                    continue;
+                rowCols[numPlaced] = cols_[e];
+                rowColOffs[numPlaced] = recvOffsets[s];
+                rowVals[numPlaced] = vals_[e];
+                ++numPlaced;
+            }
+            if( pass == 0 )
+                multMeta.localEnds[iLocal] = rowOff + numPlaced;
+        }
+        std::copy( rowCols.begin(), rowCols.end(), cols_.begin()+rowOff );
+        std::copy( rowVals.begin(), rowVals.end(), vals_.begin()+rowOff );
+        std::copy
+        ( rowColOffs.begin(), rowColOffs.end(), 
+          multMeta.colOffs.begin()+rowOff );
+        multMeta.localBegs[iLocal] = rowOff;
+    }
+    multMeta.numRecvInds = numGhostInds;
+    multMeta.ready = true;
+}
+
+template<typename T>
+inline int
+DistNodalSparseMatrix<T>::Height() const
+{ return height_; }
+
+template<typename T>
+inline int
+DistNodalSparseMatrix<T>::Width() const
+{ return width_; }
+
+template<typename T>
+inline mpi::Comm
+DistNodalSparseMatrix<T>::Comm() const
+{ return comm_; }
+
+template<typename T>
+inline int
+DistNodalSparseMatrix<T>::LocalHeight() const
+{ return rowOffs_.size()-1; }
+
+template<typename T>
+inline int
+DistNodalSparseMatrix<T>::NumLocalEntries() const
+{ return vals_.size(); }
+
+template<typename T>
+inline int
+DistNodalSparseMatrix<T>::LocalEntryOffset( int localRow ) const
+{ 
+    DEBUG_ONLY(CallStackEntry cse("DistNodalSparseMatrix::LocalEntryOffset"))
+    return rowOffs_[localRow];
+}
+
+template<typename T>
+inline int
+DistNodalSparseMatrix<T>::NumConnections( int localRow ) const
+{ 
+    DEBUG_ONLY(CallStackEntry cse("DistNodalSparseMatrix::NumConnections"))
+    return rowOffs_[localRow+1] - rowOffs_[localRow];
+}
+
+template<typename T>
+inline int
+DistNodalSparseMatrix<T>::Col( int localInd ) const
+{ 
+    DEBUG_ONLY(CallStackEntry cse("DistNodalSparseMatrix::Col"))
+    return cols_[localInd];
+}
+
+template<typename T>
+inline T
+DistNodalSparseMatrix<T>::Value( int localInd ) const
+{ 
+    DEBUG_ONLY(CallStackEntry cse("DistNodalSparseMatrix::Value"))
+    return vals_[localInd];
+}
+
+template<typename T>
+inline const T*
+DistNodalSparseMatrix<T>::LockedValueBuffer() const
+{ return &vals_[0]; }
+
+} // namespace cliq
+
+#endif // ifndef CLIQ_NUMERIC_DISTNODALSPARSEMATRIX_IMPL_HPP
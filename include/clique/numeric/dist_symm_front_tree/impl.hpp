@@ -154,10 +154,139 @@ DistSymmFrontTree<F>::Initialize
     ( &recvRows[0], &recvRowSizes[0], &recvRowOffs[0],
       &sendRows[0], &sendRowSizes[0], &sendRowOffs[0], comm );
 
+    // Form the entries of each of our local rows which lie in the lower
+    // triangle of the reordered matrix, i.e., (i,j) with reordering(j) at 
+    // least as large as reordering(i), so that the upper triangle is never 
+    // sent. With lower storage, the stored entries which lie in the reordered 
+    // upper triangle are instead transposed and sent to the owner of their
+    // column.
+    const int firstLocalRow = A.FirstLocalRow();
+    const int localHeight = A.LocalHeight();
+    const int numLocalEntries = A.NumLocalEntries();
+    std::vector<int> mappedCols( numLocalEntries );
+    for( int e=0; e<numLocalEntries; ++e )
+        mappedCols[e] = mappedTargets[Find( targets, A.Col(e) )];
+    std::vector<int> transRows, transTargets;
+    std::vector<F> transVals;
+    if( A.LowerStorage() )
+    {
+        const bool conjugateStorage = A.ConjugateStorage();
+        std::vector<int> sendSizes( commSize, 0 );
+        for( int iLocal=0; iLocal<localHeight; ++iLocal )
+        {
+            const int mappedRow = reordering.GetLocal( iLocal );
+            const int off = A.LocalEntryOffset( iLocal );
+            const int rowSize = A.NumConnections( iLocal );
+            for( int k=off; k<off+rowSize; ++k )
+                if( mappedCols[k] < mappedRow )
+                    ++sendSizes[RowToProcess( A.Col(k), blocksize, commSize )];
+        }
+        int numSends=0;
+        std::vector<int> sendOffs( commSize );
+        for( int q=0; q<commSize; ++q )
+        {
+            sendOffs[q] = numSends;
+            numSends += sendSizes[q];
+        }
+        std::vector<int> sendTransRows( numSends ), 
+                         sendTransTargets( numSends );
+        std::vector<F> sendTransVals( numSends );
+        offs = sendOffs;
+        for( int iLocal=0; iLocal<localHeight; ++iLocal )
+        {
+            const int mappedRow = reordering.GetLocal( iLocal );
+            const int off = A.LocalEntryOffset( iLocal );
+            const int rowSize = A.NumConnections( iLocal );
+            for( int k=off; k<off+rowSize; ++k )
+            {
+                if( mappedCols[k] < mappedRow )
+                {
+                    const int j = A.Col(k);
+                    const F value = A.Value(k);
+                    const int q = RowToProcess( j, blocksize, commSize );
+                    sendTransRows[offs[q]] = j;
+                    sendTransTargets[offs[q]] = mappedRow;
+                    sendTransVals[offs[q]] = 
+                        ( conjugateStorage ? elem::Conj(value) : value );
+                    ++offs[q];
+                }
+            }
+        }
+        std::vector<int> recvSizes( commSize );
+        mpi::AllToAll( &sendSizes[0], 1, &recvSizes[0], 1, comm );
+        int numRecvs=0;
+        std::vector<int> recvOffs( commSize );
+        for( int q=0; q<commSize; ++q )
+        {
+            recvOffs[q] = numRecvs;
+            numRecvs += recvSizes[q];
+        }
+        transRows.resize( numRecvs );
+        transTargets.resize( numRecvs );
+        transVals.resize( numRecvs );
+        mpi::AllToAll
+        ( &sendTransRows[0], &sendSizes[0], &sendOffs[0],
+          &transRows[0],     &recvSizes[0], &recvOffs[0], comm );
+        mpi::AllToAll
+        ( &sendTransTargets[0], &sendSizes[0], &sendOffs[0],
+          &transTargets[0],     &recvSizes[0], &recvOffs[0], comm );
+        mpi::AllToAll
+        ( &sendTransVals[0], &sendSizes[0], &sendOffs[0],
+          &transVals[0],     &recvSizes[0], &recvOffs[0], comm );
+    }
+    const int numTrans = transRows.size();
+    std::vector<int> rowLengths( localHeight, 0 );
+    for( int iLocal=0; iLocal<localHeight; ++iLocal )
+    {
+        const int mappedRow = reordering.GetLocal( iLocal );
+        const int off = A.LocalEntryOffset( iLocal );
+        const int rowSize = A.NumConnections( iLocal );
+        for( int k=off; k<off+rowSize; ++k )
+            if( mappedCols[k] >= mappedRow )
+                ++rowLengths[iLocal];
+    }
+    for( int e=0; e<numTrans; ++e )
+        ++rowLengths[transRows[e]-firstLocalRow];
+    std::vector<int> rowOffs( localHeight );
+    int numRowEntries=0;
+    for( int iLocal=0; iLocal<localHeight; ++iLocal )
+    {
+        rowOffs[iLocal] = numRowEntries;
+        numRowEntries += rowLengths[iLocal];
+    }
+    std::vector<int> rowTargets( numRowEntries );
+    std::vector<F> rowVals( numRowEntries );
+    std::vector<int> rowEnds = rowOffs;
+    for( int iLocal=0; iLocal<localHeight; ++iLocal )
+    {
+        const int mappedRow = reordering.GetLocal( iLocal );
+        const int off = A.LocalEntryOffset( iLocal );
+        const int rowSize = A.NumConnections( iLocal );
+        for( int k=off; k<off+rowSize; ++k )
+        {
+            if( mappedCols[k] >= mappedRow )
+            {
+                rowTargets[rowEnds[iLocal]] = mappedCols[k];
+                rowVals[rowEnds[iLocal]] = A.Value(k);
+                ++rowEnds[iLocal];
+            }
+        }
+    }
+    for( int e=0; e<numTrans; ++e )
+    {
+        const int iLocal = transRows[e] - firstLocalRow;
+        rowTargets[rowEnds[iLocal]] = transTargets[e];
+        rowVals[rowEnds[iLocal]] = transVals[e];
+        ++rowEnds[iLocal];
+    }
+    SwapClear( rowEnds );
+    SwapClear( mappedCols );
+    SwapClear( transRows );
+    SwapClear( transTargets );
+    SwapClear( transVals );
+
     // Pack the number of nonzeros per row (and the nonzeros themselves)
-    // TODO: Avoid sending upper-triangular data
     int numSendEntries=0;
-    const int firstLocalRow = A.FirstLocalRow();
     std::vector<int> sendRowLengths( numSendRows ),
                      sendEntriesSizes( commSize, 0 ),
                      sendEntriesOffs( commSize );
@@ -170,7 +299,7 @@ DistSymmFrontTree<F>::Initialize
         {
             const int i = sendRows[s+off];
             const int iLocal = i - firstLocalRow;
-            const int numConnections = A.NumConnections( iLocal );
+            const int numConnections = rowLengths[iLocal];
             numSendEntries += numConnections;
             sendEntriesSizes[q] += numConnections;
             sendRowLengths[s+off] = numConnections;
@@ -188,19 +317,16 @@ DistSymmFrontTree<F>::Initialize
             const int i = sendRows[s+off];
             const int iLocal = i - firstLocalRow;
             const int numConnections = sendRowLengths[s+off];
-            const int localEntryOff = A.LocalEntryOffset( iLocal );
+            const int rowOff = rowOffs[iLocal];
             for( int t=0; t<numConnections; ++t )
             {
-                const F value = A.Value( localEntryOff+t );
-                const int col = A.Col( localEntryOff+t );
-                const int targetOff = Find( targets, col );
-                const int mappedTarget = mappedTargets[targetOff];
+                const F value = rowVals[rowOff+t];
                 DEBUG_ONLY(
                     if( index >= numSendEntries )
                         LogicError("send entry index got too big");
                 )
                 sendEntries[index] = (conjugate ? elem::Conj(value) : value);
-                sendTargets[index] = mappedTarget;
+                sendTargets[index] = rowTargets[rowOff+t];
                 ++index;
             }
         }
@@ -209,6 +335,8 @@ DistSymmFrontTree<F>::Initialize
                 LogicError("index was not the correct value");
         )
     }
+    SwapClear( rowTargets );
+    SwapClear( rowVals );
 
     // Send back the number of nonzeros per row and the nonzeros themselves
     std::vector<int> recvRowLengths( numRecvRows );
@@ -0,0 +1,79 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, and Stanford University
+   All rights reserved.
+ 
+   This file is part of Clique and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef CLIQ_NUMERIC_DISTSYMMSOLVER_DECL_HPP
+#define CLIQ_NUMERIC_DISTSYMMSOLVER_DECL_HPP
+
+namespace cliq {
+
+// A stateful wrapper around the nested dissection, factorization, and
+// solution phases so that the symbolic analysis (and the factorization) can
+// be reused across many solves and refactorizations with the same pattern
+template<typename F>
+class DistSymmSolver
+{
+public:
+    DistSymmSolver();
+    DistSymmSolver
+    ( const DistSparseMatrix<F>& A, bool conjugate=false,
+      SymmFrontType factType=LDL_INTRAPIV_1D,
+      bool sequential=true, int numDistSeps=1, int numSeqSeps=1,
+      int cutoff=128 );
+
+    // Reorder via nested dissection and perform the symbolic factorization
+    void Analyze
+    ( const DistGraph& graph,
+      bool sequential=true, int numDistSeps=1, int numSeqSeps=1,
+      int cutoff=128 );
+
+    // Form the frontal tree and factor it
+    void Factor
+    ( const DistSparseMatrix<F>& A, bool conjugate=false,
+      SymmFrontType factType=LDL_INTRAPIV_1D );
+
+    // Refactor a matrix with the same sparsity pattern (but new values) using
+    // the same options as the last call to Factor
+    void Refactor( const DistSparseMatrix<F>& A );
+
+    // Overwrite X with inv(A) X
+    void Solve( DistMultiVec<F>& X ) const;
+    void Solve( DistNodalMultiVec<F>& X ) const;
+
+    bool Analyzed() const;
+    bool Factored() const;
+
+    const DistSymmInfo& Info() const;
+    const DistSeparatorTree& SepTree() const;
+    const DistMap& Map() const;
+    const DistMap& InverseMap() const;
+    const NodalRedistMeta& RedistMeta() const;
+    const DistSymmFrontTree<F>& FrontTree() const;
+
+private:
+    bool analyzed_, factored_, conjugate_;
+    SymmFrontType factType_;
+
+    DistSymmInfo info_;
+    DistSeparatorTree sepTree_;
+    DistMap map_, inverseMap_;
+    NodalRedistMeta redistMeta_;
+    DistSymmFrontTree<F> frontTree_;
+
+    // Workspace for solves in the natural ordering
+    mutable DistNodalMultiVec<F> XNodal_;
+
+    // Disallow copies, as the analysis owns communicators and grids
+    DistSymmSolver( const DistSymmSolver<F>& );
+    const DistSymmSolver<F>& operator=( const DistSymmSolver<F>& );
+};
+
+} // namespace cliq
+
+#endif // ifndef CLIQ_NUMERIC_DISTSYMMSOLVER_DECL_HPP
@@ -0,0 +1,152 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, and Stanford University
+   All rights reserved.
+ 
+   This file is part of Clique and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef CLIQ_NUMERIC_DISTSYMMSOLVER_IMPL_HPP
+#define CLIQ_NUMERIC_DISTSYMMSOLVER_IMPL_HPP
+
+namespace cliq {
+
+template<typename F>
+inline
+DistSymmSolver<F>::DistSymmSolver()
+: analyzed_(false), factored_(false), conjugate_(false),
+  factType_(LDL_INTRAPIV_1D)
+{ }
+
+template<typename F>
+inline
+DistSymmSolver<F>::DistSymmSolver
+( const DistSparseMatrix<F>& A, bool conjugate, SymmFrontType factType,
+  bool sequential, int numDistSeps, int numSeqSeps, int cutoff )
+: analyzed_(false), factored_(false), conjugate_(conjugate),
+  factType_(factType)
+{
+    DEBUG_ONLY(CallStackEntry cse("DistSymmSolver::DistSymmSolver"))
+    Analyze
+    ( A.LockedDistGraph(), sequential, numDistSeps, numSeqSeps, cutoff );
+    Factor( A, conjugate, factType );
+}
+
+template<typename F>
+inline void
+DistSymmSolver<F>::Analyze
+( const DistGraph& graph,
+  bool sequential, int numDistSeps, int numSeqSeps, int cutoff )
+{
+    DEBUG_ONLY(CallStackEntry cse("DistSymmSolver::Analyze"))
+    // The separator tree and symbolic info own communicators and grids, so
+    // we do not allow them to be silently overwritten
+    if( analyzed_ )
+        LogicError("Solver was already analyzed");
+    NestedDissection
+    ( graph, map_, sepTree_, info_,
+      sequential, numDistSeps, numSeqSeps, cutoff );
+    map_.FormInverse( inverseMap_ );
+    ComputeNodalRedistMeta( inverseMap_, info_, redistMeta_ );
+    analyzed_ = true;
+}
+
+template<typename F>
+inline void
+DistSymmSolver<F>::Factor
+( const DistSparseMatrix<F>& A, bool conjugate, SymmFrontType factType )
+{
+    DEBUG_ONLY(CallStackEntry cse("DistSymmSolver::Factor"))
+    if( !analyzed_ )
+        LogicError("Must call Analyze before Factor");
+    if( Unfactored(factType) )
+        LogicError("Front type does not correspond to a factorization");
+    conjugate_ = conjugate;
+    factType_ = factType;
+    factored_ = false;
+    // Free the fronts of any previous factorization before allocating the 
+    // new ones so that refactoring does not double the peak memory usage
+    SwapClear( frontTree_.localFronts );
+    SwapClear( frontTree_.distFronts );
+    frontTree_.Initialize( A, map_, sepTree_, info_, conjugate );
+    LDL( info_, frontTree_, factType );
+    factored_ = true;
+}
+
+template<typename F>
+inline void
+DistSymmSolver<F>::Refactor( const DistSparseMatrix<F>& A )
+{
+    DEBUG_ONLY(CallStackEntry cse("DistSymmSolver::Refactor"))
+    if( !factored_ )
+        LogicError("Must call Factor before Refactor");
+    Factor( A, conjugate_, factType_ );
+}
+
+template<typename F>
+inline void
+DistSymmSolver<F>::Solve( DistMultiVec<F>& X ) const
+{
+    DEBUG_ONLY(CallStackEntry cse("DistSymmSolver::Solve"))
+    if( !factored_ )
+        LogicError("Must call Factor before Solve");
+    XNodal_.Pull( redistMeta_, info_, X );
+    cliq::Solve( info_, frontTree_, XNodal_ );
+    XNodal_.Push( redistMeta_, info_, X );
+}
+
+template<typename F>
+inline void
+DistSymmSolver<F>::Solve( DistNodalMultiVec<F>& X ) const
+{
+    DEBUG_ONLY(CallStackEntry cse("DistSymmSolver::Solve"))
+    if( !factored_ )
+        LogicError("Must call Factor before Solve");
+    cliq::Solve( info_, frontTree_, X );
+}
+
+template<typename F>
+inline bool
+DistSymmSolver<F>::Analyzed() const
+{ return analyzed_; }
+
+template<typename F>
+inline bool
+DistSymmSolver<F>::Factored() const
+{ return factored_; }
+
+template<typename F>
+inline const DistSymmInfo&
+DistSymmSolver<F>::Info() const
+{ return info_; }
+
+template<typename F>
+inline const DistSeparatorTree&
+DistSymmSolver<F>::SepTree() const
+{ return sepTree_; }
+
+template<typename F>
+inline const DistMap&
+DistSymmSolver<F>::Map() const
+{ return map_; }
+
+template<typename F>
+inline const DistMap&
+DistSymmSolver<F>::InverseMap() const
+{ return inverseMap_; }
+
+template<typename F>
+inline const NodalRedistMeta&
+DistSymmSolver<F>::RedistMeta() const
+{ return redistMeta_; }
+
+template<typename F>
+inline const DistSymmFrontTree<F>&
+DistSymmSolver<F>::FrontTree() const
+{ return frontTree_; }
+
+} // namespace cliq
+
+#endif // ifndef CLIQ_NUMERIC_DISTSYMMSOLVER_IMPL_HPP
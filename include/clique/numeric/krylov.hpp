@@ -0,0 +1,60 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, and Stanford University
+   All rights reserved.
+ 
+   This file is part of Clique and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef CLIQ_NUMERIC_KRYLOV_HPP
+#define CLIQ_NUMERIC_KRYLOV_HPP
+
+namespace cliq {
+
+// Each of the following routines iterates on every column of X at once 
+// (X should contain the initial guesses), using Multiply to apply A and the 
+// factorization held by M as the preconditioner. The inner products for all 
+// columns are fused into as few reductions as possible. Each routine returns
+// the number of iterations performed.
+//
+// A column is considered converged once || b - A x || <= relTol || b ||. CG
+// and GMRES use the two-norm, while MINRES uses the norm induced by inv(M),
+// since that is the residual norm which its recurrence provides for free.
+
+// Conjugate gradients with a single reduction per iteration 
+// (both A and M should be Hermitian positive-definite)
+template<typename F>
+int CG
+( const DistSparseMatrix<F>& A, const DistSymmSolver<F>& M,
+  const DistMultiVec<F>& B, DistMultiVec<F>& X,
+  BASE(F) relTol=1e-6, int maxIts=1000, bool progress=false );
+
+// Preconditioned MINRES (A should be Hermitian and M should be Hermitian 
+// positive-definite)
+template<typename F>
+int MINRES
+( const DistSparseMatrix<F>& A, const DistSymmSolver<F>& M,
+  const DistMultiVec<F>& B, DistMultiVec<F>& X,
+  BASE(F) relTol=1e-6, int maxIts=1000, bool progress=false );
+
+// Right-preconditioned, restarted GMRES with two-pass classical Gram-Schmidt
+template<typename F>
+int GMRES
+( const DistSparseMatrix<F>& A, const DistSymmSolver<F>& M,
+  const DistMultiVec<F>& B, DistMultiVec<F>& X, int restart=50,
+  BASE(F) relTol=1e-6, int maxIts=1000, bool progress=false );
+
+} // namespace cliq
+
+//----------------------------------------------------------------------------//
+// Implementation begins here                                                 //
+//----------------------------------------------------------------------------//
+
+#include "./krylov/util.hpp"
+#include "./krylov/cg.hpp"
+#include "./krylov/minres.hpp"
+#include "./krylov/gmres.hpp"
+
+#endif // ifndef CLIQ_NUMERIC_KRYLOV_HPP
@@ -0,0 +1,130 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, and Stanford University
+   All rights reserved.
+ 
+   This file is part of Clique and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef CLIQ_NUMERIC_KRYLOV_CG_HPP
+#define CLIQ_NUMERIC_KRYLOV_CG_HPP
+
+namespace cliq {
+
+// This is the Chronopoulos/Gear variant of preconditioned CG, which computes
+// (r,u), (A u,u), and (r,r) together so that each iteration only requires a 
+// single reduction (for all of the columns)
+template<typename F>
+inline int
+CG
+( const DistSparseMatrix<F>& A, const DistSymmSolver<F>& M,
+  const DistMultiVec<F>& B, DistMultiVec<F>& X, 
+  BASE(F) relTol, int maxIts, bool progress )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("CG");
+        if( B.Height() != X.Height() || B.Width() != X.Width() )
+            LogicError("B and X must be the same size");
+        if( A.Height() != B.Height() || A.Width() != B.Height() )
+            LogicError("A must be square and conform with B");
+    )
+    typedef BASE(F) R;
+    mpi::Comm comm = A.Comm();
+    const int height = B.Height();
+    const int width = B.Width();
+    const int localHeight = B.LocalHeight();
+
+    std::vector<R> origNorms;
+    Norms( B, origNorms );
+
+    // r := B - A X
+    // (all of the work vectors are allocated up front and only their local
+    // entries are overwritten within the iteration)
+    DistMultiVec<F> r( height, width, comm ), u( height, width, comm ), 
+                    w( height, width, comm ), p( height, width, comm ), 
+                    s( height, width, comm );
+    internal::LocalCopy( B, r );
+    Multiply( F(-1), A, X, F(1), r );
+
+    MakeZeros( w );
+    MakeZeros( p );
+    MakeZeros( s );
+
+    std::vector<int> converged( width, false );
+    std::vector<R> alphaOld( width, 1 ), gammaOld( width, 1 ), 
+                   residNorms( width );
+    std::vector<F> alphas( width ), betas( width ), 
+                   localDots( 3*width ), dots( 3*width );
+    int it;
+    for( it=0; it<maxIts; ++it )
+    {
+        // u := inv(M) r and w := A u
+        internal::LocalCopy( r, u );
+        M.Solve( u );
+        Multiply( F(1), A, u, F(0), w );
+
+        // Fuse the three inner products into a single reduction
+        internal::LocalColumnDots( r, u, &localDots[0] );
+        internal::LocalColumnDots( w, u, &localDots[width] );
+        internal::LocalColumnDots( r, r, &localDots[2*width] );
+        mpi::AllReduce( &localDots[0], &dots[0], 3*width, mpi::SUM, comm );
+        for( int j=0; j<width; ++j )
+            residNorms[j] = Sqrt(elem::RealPart(dots[2*width+j]));
+        if( internal::CheckConvergence
+            ( residNorms, origNorms, relTol, converged, it, "CG", 
+              progress, comm ) )
+            break;
+
+        for( int j=0; j<width; ++j )
+        {
+            if( converged[j] )
+            {
+                alphas[j] = betas[j] = 0;
+                continue;
+            }
+            const R gamma = elem::RealPart(dots[j]);
+            const R delta = elem::RealPart(dots[width+j]);
+            R alpha, beta;
+            if( it == 0 )
+            {
+                beta = 0;
+                alpha = gamma / delta;
+            }
+            else
+            {
+                beta = gamma / gammaOld[j];
+                alpha = gamma / (delta - beta*gamma/alphaOld[j]);
+            }
+            gammaOld[j] = gamma;
+            alphaOld[j] = alpha;
+            alphas[j] = alpha;
+            betas[j] = beta;
+        }
+
+        // p := u + beta p,  s := w + beta s,  X := X + alpha p,  
+        // r := r - alpha s
+        for( int j=0; j<width; ++j )
+        {
+            if( converged[j] )
+                continue;
+            const F alpha = alphas[j];
+            const F beta = betas[j];
+            for( int iLocal=0; iLocal<localHeight; ++iLocal )
+            {
+                const F pVal = u.GetLocal(iLocal,j) + beta*p.GetLocal(iLocal,j);
+                const F sVal = w.GetLocal(iLocal,j) + beta*s.GetLocal(iLocal,j);
+                p.SetLocal( iLocal, j, pVal );
+                s.SetLocal( iLocal, j, sVal );
+                X.UpdateLocal( iLocal, j, alpha*pVal );
+                r.UpdateLocal( iLocal, j, -alpha*sVal );
+            }
+        }
+    }
+    return it;
+}
+
+} // namespace cliq
+
+#endif // ifndef CLIQ_NUMERIC_KRYLOV_CG_HPP
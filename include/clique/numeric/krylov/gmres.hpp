@@ -0,0 +1,251 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, and Stanford University
+   All rights reserved.
+ 
+   This file is part of Clique and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef CLIQ_NUMERIC_KRYLOV_GMRES_HPP
+#define CLIQ_NUMERIC_KRYLOV_GMRES_HPP
+
+namespace cliq {
+
+// Right-preconditioned GMRES(m). Each new Krylov vector is orthogonalized 
+// with two passes of classical Gram-Schmidt so that each pass requires a 
+// single reduction; the norm of the new vector is fused into the second pass.
+// Since the preconditioner is fixed, only the Krylov basis is stored and the
+// preconditioner is applied once more at the end of each cycle.
+template<typename F>
+inline int
+GMRES
+( const DistSparseMatrix<F>& A, const DistSymmSolver<F>& M,
+  const DistMultiVec<F>& B, DistMultiVec<F>& X, int restart,
+  BASE(F) relTol, int maxIts, bool progress )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("GMRES");
+        if( B.Height() != X.Height() || B.Width() != X.Width() )
+            LogicError("B and X must be the same size");
+        if( A.Height() != B.Height() || A.Width() != B.Height() )
+            LogicError("A must be square and conform with B");
+        if( restart < 1 )
+            LogicError("Restart parameter must be positive");
+    )
+    typedef BASE(F) R;
+    mpi::Comm comm = A.Comm();
+    const int height = B.Height();
+    const int width = B.Width();
+    const int m = restart;
+
+    std::vector<R> origNorms;
+    Norms( B, origNorms );
+
+    // NOTE: DistMultiVec is not copy-constructible, so V must be constructed
+    //       in place and never resized
+    std::vector<DistMultiVec<F> > V( m+1 );
+    for( int k=0; k<m+1; ++k )
+    {
+        V[k].SetComm( comm );
+        V[k].ResizeTo( height, width );
+    }
+    DistMultiVec<F> z( height, width, comm ), w( height, width, comm );
+    MakeZeros( w );
+
+    // The Hessenberg matrices, rotations, and right-hand sides of the least
+    // squares problems for each column
+    std::vector<Matrix<F> > H( width );
+    std::vector<std::vector<R> > cs( width, std::vector<R>(m) );
+    std::vector<std::vector<F> > sn( width, std::vector<F>(m) ),
+                                 g( width, std::vector<F>(m+1) );
+    std::vector<int> converged( width, false ), numSteps( width );
+    std::vector<int> active( width );
+    std::vector<R> residNorms( width ), normSquares( width );
+    std::vector<F> localDots( (m+1)*width ), dots( (m+1)*width ), 
+                   scales( width ), coeffs( width );
+
+    int it=0;
+    while( it < maxIts )
+    {
+        // V[0] := B - A X
+        internal::LocalCopy( B, V[0] );
+        Multiply( F(-1), A, X, F(1), V[0] );
+        internal::LocalColumnDots( V[0], V[0], &localDots[0] );
+        mpi::AllReduce( &localDots[0], &dots[0], width, mpi::SUM, comm );
+        for( int j=0; j<width; ++j )
+            residNorms[j] = Sqrt(elem::RealPart(dots[j]));
+        if( internal::CheckConvergence
+            ( residNorms, origNorms, relTol, converged, it, "GMRES", 
+              progress, comm ) )
+            break;
+
+        // V[0] := V[0] / || V[0] ||
+        for( int j=0; j<width; ++j )
+        {
+            Zeros( H[j], m+1, m );
+            std::fill( g[j].begin(), g[j].end(), F(0) );
+            g[j][0] = residNorms[j];
+            numSteps[j] = 0;
+            scales[j] = ( converged[j] ? F(0) : F(1)/residNorms[j] );
+        }
+        internal::ColumnScale( scales, V[0] );
+
+        for( int j=0; j<width; ++j )
+            active[j] = !converged[j];
+        for( int k=0; k<m && it<maxIts; ++k, ++it )
+        {
+            // w := A inv(M) V[k]
+            internal::LocalCopy( V[k], z );
+            M.Solve( z );
+            Multiply( F(1), A, z, F(0), w );
+
+            // First pass of classical Gram-Schmidt, h := V^H w, w := w - V h
+            for( int i=0; i<=k; ++i )
+                internal::LocalColumnDots( V[i], w, &localDots[i*width] );
+            mpi::AllReduce
+            ( &localDots[0], &dots[0], (k+1)*width, mpi::SUM, comm );
+            for( int i=0; i<=k; ++i )
+            {
+                for( int j=0; j<width; ++j )
+                {
+                    const F h = ( active[j] ? dots[i*width+j] : F(0) );
+                    H[j].Set( i, k, h );
+                    coeffs[j] = -h;
+                }
+                internal::ColumnAxpy( coeffs, V[i], w );
+            }
+
+            // Second pass, fused with the computation of || w ||^2
+            for( int i=0; i<=k; ++i )
+                internal::LocalColumnDots( V[i], w, &localDots[i*width] );
+            internal::LocalColumnDots( w, w, &localDots[(k+1)*width] );
+            mpi::AllReduce
+            ( &localDots[0], &dots[0], (k+2)*width, mpi::SUM, comm );
+            for( int j=0; j<width; ++j )
+                normSquares[j] = elem::RealPart(dots[(k+1)*width+j]);
+            for( int i=0; i<=k; ++i )
+            {
+                for( int j=0; j<width; ++j )
+                {
+                    const F h = ( active[j] ? dots[i*width+j] : F(0) );
+                    H[j].Update( i, k, h );
+                    normSquares[j] -= elem::RealPart(elem::Conj(h)*h);
+                    coeffs[j] = -h;
+                }
+                internal::ColumnAxpy( coeffs, V[i], w );
+            }
+
+            for( int j=0; j<width; ++j )
+            {
+                if( !active[j] )
+                {
+                    scales[j] = 0;
+                    continue;
+                }
+                const R hNext = Sqrt(std::max(normSquares[j],R(0)));
+                Matrix<F>& HCol = H[j];
+
+                // Apply the previous rotations to the new column
+                for( int i=0; i<k; ++i )
+                {
+                    const F eta0 = HCol.Get(i,k);
+                    const F eta1 = HCol.Get(i+1,k);
+                    HCol.Set( i,   k,  cs[j][i]*eta0 + sn[j][i]*eta1 );
+                    HCol.Set
+                    ( i+1, k, -elem::Conj(sn[j][i])*eta0 + cs[j][i]*eta1 );
+                }
+
+                // Form the rotation which annihilates hNext
+                const F alpha = HCol.Get(k,k);
+                const R alphaAbs = Abs(alpha);
+                const R denom = Sqrt(alphaAbs*alphaAbs + hNext*hNext);
+                if( alphaAbs == R(0) )
+                {
+                    cs[j][k] = 0;
+                    sn[j][k] = 1;
+                }
+                else
+                {
+                    cs[j][k] = alphaAbs / denom;
+                    sn[j][k] = (alpha/alphaAbs)*hNext/denom;
+                }
+                HCol.Set( k, k, cs[j][k]*alpha + sn[j][k]*hNext );
+                g[j][k+1] = -elem::Conj(sn[j][k])*g[j][k];
+                g[j][k] = cs[j][k]*g[j][k];
+                numSteps[j] = k+1;
+
+                residNorms[j] = Abs(g[j][k+1]);
+                const R relNorm = 
+                    ( origNorms[j] == R(0) ? R(0) : residNorms[j]/origNorms[j] );
+                if( relNorm <= relTol || hNext == R(0) )
+                {
+                    // This column has converged (or had a lucky breakdown)
+                    active[j] = false;
+                    scales[j] = 0;
+                }
+                else
+                    scales[j] = F(1)/hNext;
+            }
+
+            // V[k+1] := w / hNext
+            internal::LocalCopy( w, V[k+1] );
+            internal::ColumnScale( scales, V[k+1] );
+
+            bool anyActive = false;
+            for( int j=0; j<width; ++j )
+                anyActive = anyActive || active[j];
+            if( progress && mpi::CommRank( comm ) == 0 )
+            {
+                R maxRelNorm = 0;
+                for( int j=0; j<width; ++j )
+                    if( origNorms[j] != R(0) )
+                        maxRelNorm = 
+                            std::max( maxRelNorm, residNorms[j]/origNorms[j] );
+                std::cout << "  GMRES inner iteration " << it 
+                          << ": max relative residual estimate " << maxRelNorm
+                          << std::endl;
+            }
+            if( !anyActive )
+            {
+                ++it;
+                break;
+            }
+        }
+
+        // Solve the triangular systems, R y = g, and form z := V y
+        // (overwriting g with y)
+        MakeZeros( z );
+        int maxSteps = 0;
+        for( int j=0; j<width; ++j )
+        {
+            const int numStep = numSteps[j];
+            maxSteps = std::max( maxSteps, numStep );
+            for( int i=numStep-1; i>=0; --i )
+            {
+                F gamma = g[j][i];
+                for( int l=i+1; l<numStep; ++l )
+                    gamma -= H[j].Get(i,l)*g[j][l];
+                g[j][i] = gamma / H[j].Get(i,i);
+            }
+        }
+        for( int i=0; i<maxSteps; ++i )
+        {
+            for( int j=0; j<width; ++j )
+                coeffs[j] = ( i < numSteps[j] ? g[j][i] : F(0) );
+            internal::ColumnAxpy( coeffs, V[i], z );
+        }
+
+        // X := X + inv(M) z
+        M.Solve( z );
+        for( int j=0; j<width; ++j )
+            coeffs[j] = 1;
+        internal::ColumnAxpy( coeffs, z, X );
+    }
+    return it;
+}
+
+} // namespace cliq
+
+#endif // ifndef CLIQ_NUMERIC_KRYLOV_GMRES_HPP
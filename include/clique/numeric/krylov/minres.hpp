@@ -0,0 +1,188 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, and Stanford University
+   All rights reserved.
+ 
+   This file is part of Clique and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef CLIQ_NUMERIC_KRYLOV_MINRES_HPP
+#define CLIQ_NUMERIC_KRYLOV_MINRES_HPP
+
+namespace cliq {
+
+// Preconditioned MINRES following Algorithm 6.1 of Elman, Silvester, and 
+// Wathen, "Finite Elements and Fast Iterative Solvers". The residual norm 
+// estimate (in the inv(M) norm) comes for free from the Givens rotations, so 
+// each iteration requires two reductions (for all of the columns). The 
+// estimate is measured relative to the inv(M) norm of B, which costs one 
+// extra application of the preconditioner up front.
+template<typename F>
+inline int
+MINRES
+( const DistSparseMatrix<F>& A, const DistSymmSolver<F>& M,
+  const DistMultiVec<F>& B, DistMultiVec<F>& X, 
+  BASE(F) relTol, int maxIts, bool progress )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("MINRES");
+        if( B.Height() != X.Height() || B.Width() != X.Width() )
+            LogicError("B and X must be the same size");
+        if( A.Height() != B.Height() || A.Width() != B.Height() )
+            LogicError("A must be square and conform with B");
+    )
+    typedef BASE(F) R;
+    mpi::Comm comm = A.Comm();
+    const int height = B.Height();
+    const int width = B.Width();
+
+    // The work vectors are allocated once, and the three-term recurrences 
+    // are shifted by rotating pointers rather than by copying (assignment
+    // would also duplicate the communicator of each vector)
+    DistMultiVec<F> v0( height, width, comm ), v1( height, width, comm ),
+                    v2( height, width, comm ), z0( height, width, comm ),
+                    z1( height, width, comm ), w0( height, width, comm ),
+                    w1( height, width, comm ), w2( height, width, comm );
+    DistMultiVec<F> *vOld=&v0, *v=&v1, *vNew=&v2, *z=&z0, *zNew=&z1,
+                    *wOld=&w0, *w=&w1, *wNew=&w2;
+    MakeZeros( *vOld );
+    MakeZeros( *vNew );
+    MakeZeros( *wOld );
+    MakeZeros( *w );
+
+    // zNew := inv(M) B, v := B - A X, and z := inv(M) v
+    internal::LocalCopy( B, *zNew );
+    M.Solve( *zNew );
+    internal::LocalCopy( B, *v );
+    Multiply( F(-1), A, X, F(1), *v );
+    internal::LocalCopy( *v, *z );
+    M.Solve( *z );
+
+    // Compute || B ||_inv(M) and || v ||_inv(M) with a single reduction
+    std::vector<F> localDots( 2*width ), dots( 2*width );
+    internal::LocalColumnDots( *z, *v, &localDots[0] );
+    internal::LocalColumnDots( *zNew, B, &localDots[width] );
+    mpi::AllReduce( &localDots[0], &dots[0], 2*width, mpi::SUM, comm );
+
+    std::vector<int> converged( width, false );
+    std::vector<R> gamma( width ), gammaOld( width, 1 ), gammaNew( width ),
+                   eta( width ), origNorms( width ), residNorms( width ),
+                   c( width, 1 ), cOld( width, 1 ), s( width, 0 ), 
+                   sOld( width, 0 );
+    for( int j=0; j<width; ++j )
+    {
+        gamma[j] = Sqrt(elem::RealPart(dots[j]));
+        eta[j] = gamma[j];
+        origNorms[j] = Sqrt(Abs(elem::RealPart(dots[width+j])));
+        residNorms[j] = gamma[j];
+        // Avoid dividing by zero for columns which have already converged
+        if( gamma[j] == R(0) )
+        {
+            converged[j] = true;
+            gamma[j] = 1;
+        }
+    }
+
+    std::vector<F> scales( width ), alphas( width ), betas( width ),
+                   wScales( width ), wOldScales( width ), xScales( width ),
+                   gammaDots( width );
+    int it;
+    for( it=0; it<maxIts; ++it )
+    {
+        if( internal::CheckConvergence
+            ( residNorms, origNorms, relTol, converged, it, "MINRES", 
+              progress, comm ) )
+            break;
+
+        // z := z / gamma
+        for( int j=0; j<width; ++j )
+            scales[j] = ( converged[j] ? F(1) : F(1)/gamma[j] );
+        internal::ColumnScale( scales, *z );
+
+        // vNew := A z and delta := (A z, z)
+        Multiply( F(1), A, *z, F(0), *vNew );
+        internal::LocalColumnDots( *z, *vNew, &localDots[0] );
+        mpi::AllReduce( &localDots[0], &dots[0], width, mpi::SUM, comm );
+
+        // vNew := vNew - (delta/gamma) v - (gamma/gammaOld) vOld
+        for( int j=0; j<width; ++j )
+        {
+            const R delta = elem::RealPart(dots[j]);
+            alphas[j] = ( converged[j] ? F(0) : -delta/gamma[j] );
+            betas[j] = ( converged[j] ? F(0) : -gamma[j]/gammaOld[j] );
+        }
+        internal::ColumnAxpy( alphas, *v, *vNew );
+        internal::ColumnAxpy( betas, *vOld, *vNew );
+
+        // zNew := inv(M) vNew and gammaNew := sqrt((zNew,vNew))
+        internal::LocalCopy( *vNew, *zNew );
+        M.Solve( *zNew );
+        internal::LocalColumnDots( *zNew, *vNew, &localDots[0] );
+        mpi::AllReduce( &localDots[0], &gammaDots[0], width, mpi::SUM, comm );
+
+        // Update the QR factorization of the tridiagonal matrix and form
+        // wNew := (z - alpha3 wOld - alpha2 w) / alpha1
+        for( int j=0; j<width; ++j )
+        {
+            if( converged[j] )
+            {
+                wScales[j] = wOldScales[j] = xScales[j] = 0;
+                scales[j] = 1;
+                gammaNew[j] = gamma[j];
+                continue;
+            }
+            const R delta = elem::RealPart(dots[j]);
+            gammaNew[j] = Sqrt(Abs(elem::RealPart(gammaDots[j])));
+            const R alpha0 = c[j]*delta - cOld[j]*s[j]*gamma[j];
+            const R alpha1 = Sqrt(alpha0*alpha0 + gammaNew[j]*gammaNew[j]);
+            const R alpha2 = s[j]*delta + cOld[j]*c[j]*gamma[j];
+            const R alpha3 = sOld[j]*gamma[j];
+            const R cNew = alpha0/alpha1;
+            const R sNew = gammaNew[j]/alpha1;
+            wOldScales[j] = -alpha3;
+            wScales[j] = -alpha2;
+            scales[j] = R(1)/alpha1;
+            xScales[j] = cNew*eta[j];
+            eta[j] = -sNew*eta[j];
+            residNorms[j] = Abs(eta[j]);
+
+            cOld[j] = c[j];
+            c[j] = cNew;
+            sOld[j] = s[j];
+            s[j] = sNew;
+        }
+        internal::LocalCopy( *z, *wNew );
+        internal::ColumnAxpy( wOldScales, *wOld, *wNew );
+        internal::ColumnAxpy( wScales, *w, *wNew );
+        internal::ColumnScale( scales, *wNew );
+
+        // X := X + c eta wNew
+        internal::ColumnAxpy( xScales, *wNew, X );
+
+        // Shift the recurrences (a lucky breakdown means we have converged)
+        std::swap( vOld, v );
+        std::swap( v, vNew );
+        std::swap( z, zNew );
+        std::swap( wOld, w );
+        std::swap( w, wNew );
+        for( int j=0; j<width; ++j )
+        {
+            if( converged[j] )
+                continue;
+            gammaOld[j] = gamma[j];
+            gamma[j] = gammaNew[j];
+            if( gamma[j] == R(0) )
+            {
+                converged[j] = true;
+                gamma[j] = 1;
+            }
+        }
+    }
+    return it;
+}
+
+} // namespace cliq
+
+#endif // ifndef CLIQ_NUMERIC_KRYLOV_MINRES_HPP
@@ -0,0 +1,121 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, and Stanford University
+   All rights reserved.
+ 
+   This file is part of Clique and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef CLIQ_NUMERIC_KRYLOV_UTIL_HPP
+#define CLIQ_NUMERIC_KRYLOV_UTIL_HPP
+
+namespace cliq {
+namespace internal {
+
+// Y := X, restricted to our local rows (Y must already have the same size and
+// communicator, so that, unlike assignment, no communicator is duplicated)
+template<typename F>
+inline void
+LocalCopy( const DistMultiVec<F>& X, DistMultiVec<F>& Y )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("internal::LocalCopy");
+        if( X.Height() != Y.Height() || X.Width() != Y.Width() )
+            LogicError("X and Y must be the same size");
+    )
+    const int localHeight = X.LocalHeight();
+    const int width = X.Width();
+    const F* XBuf = X.LockedBuffer();
+    F* YBuf = Y.Buffer();
+    const int XLDim = X.LDim();
+    const int YLDim = Y.LDim();
+    for( int j=0; j<width; ++j )
+        elem::MemCopy( &YBuf[j*YLDim], &XBuf[j*XLDim], localHeight );
+}
+
+// dots[j] := X(:,j)^H Y(:,j), restricted to our local rows
+template<typename F>
+inline void
+LocalColumnDots( const DistMultiVec<F>& X, const DistMultiVec<F>& Y, F* dots )
+{
+    DEBUG_ONLY(CallStackEntry cse("internal::LocalColumnDots"))
+    const int localHeight = X.LocalHeight();
+    const int width = X.Width();
+    for( int j=0; j<width; ++j )
+    {
+        F dot = 0;
+        for( int iLocal=0; iLocal<localHeight; ++iLocal )
+            dot += elem::Conj(X.GetLocal(iLocal,j))*Y.GetLocal(iLocal,j);
+        dots[j] = dot;
+    }
+}
+
+// Y(:,j) := alphas[j] X(:,j) + Y(:,j)
+template<typename F>
+inline void
+ColumnAxpy
+( const std::vector<F>& alphas, const DistMultiVec<F>& X, DistMultiVec<F>& Y )
+{
+    DEBUG_ONLY(CallStackEntry cse("internal::ColumnAxpy"))
+    const int localHeight = X.LocalHeight();
+    const int width = X.Width();
+    for( int j=0; j<width; ++j )
+    {
+        const F alpha = alphas[j];
+        if( alpha != F(0) )
+            for( int iLocal=0; iLocal<localHeight; ++iLocal )
+                Y.UpdateLocal( iLocal, j, alpha*X.GetLocal(iLocal,j) );
+    }
+}
+
+// X(:,j) := alphas[j] X(:,j)
+template<typename F>
+inline void
+ColumnScale( const std::vector<F>& alphas, DistMultiVec<F>& X )
+{
+    DEBUG_ONLY(CallStackEntry cse("internal::ColumnScale"))
+    const int localHeight = X.LocalHeight();
+    const int width = X.Width();
+    for( int j=0; j<width; ++j )
+    {
+        const F alpha = alphas[j];
+        if( alpha != F(1) )
+            for( int iLocal=0; iLocal<localHeight; ++iLocal )
+                X.SetLocal( iLocal, j, alpha*X.GetLocal(iLocal,j) );
+    }
+}
+
+// Check which columns have converged and (optionally) report progress
+template<typename R>
+inline bool
+CheckConvergence
+( const std::vector<R>& residNorms, const std::vector<R>& origNorms, 
+  R relTol, std::vector<int>& converged, int it, const std::string& name,
+  bool progress, mpi::Comm comm )
+{
+    DEBUG_ONLY(CallStackEntry cse("internal::CheckConvergence"))
+    const int width = residNorms.size();
+    bool allConverged = true;
+    R maxRelNorm = 0;
+    for( int j=0; j<width; ++j )
+    {
+        const R relNorm = 
+            ( origNorms[j] == R(0) ? R(0) : residNorms[j]/origNorms[j] );
+        maxRelNorm = std::max( maxRelNorm, relNorm );
+        if( relNorm <= relTol )
+            converged[j] = true;
+        else
+            allConverged = false;
+    }
+    if( progress && mpi::CommRank( comm ) == 0 )
+        std::cout << name << " iteration " << it << ": max relative residual "
+                  << maxRelNorm << std::endl;
+    return allConverged;
+}
+
+} // namespace internal
+} // namespace cliq
+
+#endif // ifndef CLIQ_NUMERIC_KRYLOV_UTIL_HPP
@@ -49,22 +49,20 @@ LocalLDL( DistSymmInfo& info, DistSymmFrontTree<F>& L )
         // Add updates from children (if they exist)
         Zeros( frontBR, updateSize, updateSize );
         const int numChildren = node.children.size();
-        if( numChildren == 2 )
+        for( int c=0; c<numChildren; ++c )
         {
-            const int leftInd = node.children[0];
-            const int rightInd = node.children[1];
-            Matrix<F>& leftUpdate = L.localFronts[leftInd].work;
-            Matrix<F>& rightUpdate = L.localFronts[rightInd].work;
+            Matrix<F>& childUpdate = L.localFronts[node.children[c]].work;
+            const std::vector<int>& childRelInds = node.childRelInds[c];
 
-            // Add the left child's update matrix
-            const int leftUpdateSize = leftUpdate.Height();
-            for( int jChild=0; jChild<leftUpdateSize; ++jChild )
+            // Add this child's update matrix
+            const int childUpdateSize = childUpdate.Height();
+            for( int jChild=0; jChild<childUpdateSize; ++jChild )
             {
-                const int jFront = node.leftRelInds[jChild];
-                for( int iChild=jChild; iChild<leftUpdateSize; ++iChild )
+                const int jFront = childRelInds[jChild];
+                for( int iChild=jChild; iChild<childUpdateSize; ++iChild )
                 {
-                    const int iFront = node.leftRelInds[iChild];
-                    const F value = leftUpdate.Get(iChild,jChild);
+                    const int iFront = childRelInds[iChild];
+                    const F value = childUpdate.Get(iChild,jChild);
                     DEBUG_ONLY(
                         if( iFront < jFront )
                             LogicError("Tried to update upper triangle");
@@ -76,29 +74,7 @@ LocalLDL( DistSymmInfo& info, DistSymmFrontTree<F>& L )
                         ( iFront-node.size, jFront-node.size, value );
                 }
             }
-            leftUpdate.Empty();
-
-            // Add the right child's update matrix
-            const int rightUpdateSize = rightUpdate.Height();
-            for( int jChild=0; jChild<rightUpdateSize; ++jChild )
-            {
-                const int jFront = node.rightRelInds[jChild];
-                for( int iChild=jChild; iChild<rightUpdateSize; ++iChild )
-                {
-                    const int iFront = node.rightRelInds[iChild];
-                    const F value = rightUpdate.Get(iChild,jChild);
-                    DEBUG_ONLY(
-                        if( iFront < jFront )
-                            LogicError("Tried to update upper triangle");
-                    )
-                    if( jFront < node.size )
-                        frontL.Update( iFront, jFront, value );
-                    else if( iFront >= node.size )
-                        frontBR.Update
-                        ( iFront-node.size, jFront-node.size, value );
-                }
-            }
-            rightUpdate.Empty();
+            childUpdate.Empty();
         }
 
         // Call the custom partial LDL
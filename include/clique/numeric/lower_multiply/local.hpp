@@ -55,41 +55,26 @@ inline void LocalLowerMultiplyNormal
 
         // Update using the children (if they exist)
         const int numChildren = node.children.size();
-        if( numChildren == 2 )
+        for( int c=0; c<numChildren; ++c )
         {
-            const int leftInd = node.children[0];
-            const int rightInd = node.children[1];
-            Matrix<T>& leftWork = L.localFronts[leftInd].work;
-            Matrix<T>& rightWork = L.localFronts[rightInd].work;
-            const int leftNodeSize = info.localNodes[leftInd].size;
-            const int rightNodeSize = info.localNodes[rightInd].size;
-            const int leftUpdateSize = leftWork.Height()-leftNodeSize;
-            const int rightUpdateSize = rightWork.Height()-rightNodeSize;
-
-            // Add the left child's update onto ours
-            auto leftUpdate =
-                LockedView( leftWork, leftNodeSize, 0, leftUpdateSize, width );
-            for( int iChild=0; iChild<leftUpdateSize; ++iChild )
-            {
-                const int iFront = node.leftRelInds[iChild];
-                for( int j=0; j<width; ++j )
-                    W.Update( iFront, j, leftUpdate.Get(iChild,j) );
-            }
-            leftWork.Empty();
-
-            // Add the right child's update onto ours
-            auto rightUpdate =
+            const int childInd = node.children[c];
+            Matrix<T>& childWork = L.localFronts[childInd].work;
+            const int childNodeSize = info.localNodes[childInd].size;
+            const int childUpdateSize = childWork.Height()-childNodeSize;
+            const std::vector<int>& childRelInds = node.childRelInds[c];
+
+            // Add this child's update onto ours
+            auto childUpdate =
                 LockedView
-                ( rightWork, rightNodeSize, 0, rightUpdateSize, width );
-            for( int iChild=0; iChild<rightUpdateSize; ++iChild )
+                ( childWork, childNodeSize, 0, childUpdateSize, width );
+            for( int iChild=0; iChild<childUpdateSize; ++iChild )
             {
-                const int iFront = node.rightRelInds[iChild];
+                const int iFront = childRelInds[iChild];
                 for( int j=0; j<width; ++j )
-                    W.Update( iFront, j, rightUpdate.Get(iChild,j) );
+                    W.Update( iFront, j, childUpdate.Get(iChild,j) );
             }
-            rightWork.Empty();
+            childWork.Empty();
         }
-        // else numChildren == 0 
 
         // Store this node's portion of the result
         X.localNodes[s] = WT;
@@ -125,7 +110,7 @@ inline void LocalLowerMultiplyTranspose
         Matrix<T>& parentWork = L.localFronts[parent].work;
         const int currentUpdateSize = WB.Height();
         const std::vector<int>& parentRelInds = 
-            ( node.onLeft ? parentNode.leftRelInds : parentNode.rightRelInds );
+            parentNode.childRelInds[node.whichChild];
         for( int iCurrent=0; iCurrent<currentUpdateSize; ++iCurrent )
         {
             const int iParent = parentRelInds[iCurrent]; 
@@ -133,9 +118,9 @@ inline void LocalLowerMultiplyTranspose
                 WB.Set( iCurrent, j, parentWork.Get(iParent,j) );
         }
 
-        // The left child is numbered lower than the right child, so we can 
-        // safely free the parent's work if this node is the left child
-        if( node.onLeft )
+        // The first child is numbered lower than the other children, so we 
+        // can safely free the parent's work if this node is the first child
+        if( node.whichChild == 0 )
         {
             parentWork.Empty();
             if( parent == numLocalNodes-1 )
@@ -363,6 +363,7 @@ inline void DistLowerBackwardSolve
     const bool frontsAre1d = FrontsAre1d( frontType );
     const bool blocked = BlockFactorization( frontType );
     const bool pivoted = PivotedFactorization( frontType );
+    const bool selInv = SelInvFactorization( frontType );
 
     // Directly operate on the root separator's portion of the right-hand sides
     const SymmFront<F>& localRootFront = L.localFronts.back();
@@ -372,6 +373,13 @@ inline void DistLowerBackwardSolve
         if( blocked )
             FrontBlockLowerBackwardSolve
             ( localRootFront.frontL, localRootFront.work, conjugate );
+        else if( selInv && pivoted )
+            FrontFastIntraPivLowerBackwardSolve
+            ( localRootFront.frontL, localRootFront.piv, 
+              localRootFront.work, conjugate );
+        else if( selInv )
+            FrontFastLowerBackwardSolve
+            ( localRootFront.frontL, localRootFront.work, conjugate );
         else if( pivoted )
             FrontIntraPivLowerBackwardSolve
             ( localRootFront.frontL, localRootFront.piv, localRootFront.work, 
@@ -536,6 +544,13 @@ inline void DistLowerBackwardSolve
             if( blocked )
                 FrontBlockLowerBackwardSolve
                 ( localRootFront.frontL, localRootFront.work, conjugate );
+            else if( selInv && pivoted )
+                FrontFastIntraPivLowerBackwardSolve
+                ( localRootFront.frontL, localRootFront.piv, 
+                  localRootFront.work, conjugate );
+            else if( selInv )
+                FrontFastLowerBackwardSolve
+                ( localRootFront.frontL, localRootFront.work, conjugate );
             else if( pivoted )
                 FrontIntraPivLowerBackwardSolve
                 ( localRootFront.frontL, localRootFront.piv, 
@@ -565,6 +580,7 @@ inline void DistLowerBackwardSolve
         LogicError("1d solves not yet implemented");
     const bool blocked = BlockFactorization( frontType );
     const bool pivoted = PivotedFactorization( frontType );
+    const bool selInv = SelInvFactorization( frontType );
 
     // Directly operate on the root separator's portion of the right-hand sides
     const SymmFront<F>& localRootFront = L.localFronts.back();
@@ -574,6 +590,13 @@ inline void DistLowerBackwardSolve
         if( blocked )
             FrontBlockLowerBackwardSolve
             ( localRootFront.frontL, localRootFront.work, conjugate );
+        else if( selInv && pivoted )
+            FrontFastIntraPivLowerBackwardSolve
+            ( localRootFront.frontL, localRootFront.piv, 
+              localRootFront.work, conjugate );
+        else if( selInv )
+            FrontFastLowerBackwardSolve
+            ( localRootFront.frontL, localRootFront.work, conjugate );
         else if( pivoted )
             FrontIntraPivLowerBackwardSolve
             ( localRootFront.frontL, localRootFront.piv, localRootFront.work,
@@ -734,6 +757,13 @@ inline void DistLowerBackwardSolve
             if( blocked )
                 FrontBlockLowerBackwardSolve
                 ( localRootFront.frontL, localRootFront.work, conjugate );
+            else if( selInv && pivoted )
+                FrontFastIntraPivLowerBackwardSolve
+                ( localRootFront.frontL, localRootFront.piv, 
+                  localRootFront.work, conjugate );
+            else if( selInv )
+                FrontFastLowerBackwardSolve
+                ( localRootFront.frontL, localRootFront.work, conjugate );
             else if( pivoted )
                 FrontIntraPivLowerBackwardSolve
                 ( localRootFront.frontL, localRootFront.piv, 
@@ -86,7 +86,7 @@ inline void FrontFastLowerForwardSolve
     const Grid& g = L.Grid();
     if( g.Size() == 1 )
     {
-        FrontLowerForwardSolve( L.LockedMatrix(), X.Matrix() );
+        FrontFastLowerForwardSolve( L.LockedMatrix(), X.Matrix() );
         return;
     }
 
@@ -144,7 +144,7 @@ inline void FrontFastLowerForwardSolve
     const Grid& g = L.Grid();
     if( g.Size() == 1 )
     {
-        FrontLowerForwardSolve( L.LockedMatrix(), X.Matrix() );
+        FrontFastLowerForwardSolve( L.LockedMatrix(), X.Matrix() );
         return;
     }
 
@@ -221,7 +221,7 @@ inline void FrontFastLowerForwardSolve
     const Grid& g = L.Grid();
     if( g.Size() == 1 )
     {
-        FrontLowerForwardSolve( L.LockedMatrix(), X.Matrix() );
+        FrontFastLowerForwardSolve( L.LockedMatrix(), X.Matrix() );
         return;
     }
 
@@ -277,7 +277,8 @@ inline void FrontFastLowerBackwardSolve
     const Grid& g = L.Grid();
     if( g.Size() == 1 )
     {
-        FrontLowerBackwardSolve( L.LockedMatrix(), X.Matrix(), conjugate );
+        FrontFastLowerBackwardSolve
+        ( L.LockedMatrix(), X.Matrix(), conjugate );
         return;
     }
 
@@ -336,7 +337,8 @@ inline void FrontFastLowerBackwardSolve
     const Grid& g = L.Grid();
     if( g.Size() == 1 )
     {
-        FrontLowerBackwardSolve( L.LockedMatrix(), X.Matrix(), conjugate );
+        FrontFastLowerBackwardSolve
+        ( L.LockedMatrix(), X.Matrix(), conjugate );
         return;
     }
 
@@ -423,7 +425,8 @@ inline void FrontFastLowerBackwardSolve
     const Grid& g = L.Grid();
     if( g.Size() == 1 )
     {
-        FrontLowerBackwardSolve( L.LockedMatrix(), X.Matrix(), conjugate );
+        FrontFastLowerBackwardSolve
+        ( L.LockedMatrix(), X.Matrix(), conjugate );
         return;
     }
 
@@ -51,6 +51,7 @@ inline void LocalLowerForwardSolve
         LogicError("Nonsensical front type for solve");
     const bool blocked = BlockFactorization( frontType );
     const bool pivoted = PivotedFactorization( frontType );
+    const bool selInv = SelInvFactorization( frontType );
 
     for( int s=0; s<numLocalNodes; ++s )
     {
@@ -68,45 +69,34 @@ inline void LocalLowerForwardSolve
 
         // Update using the children (if they exist)
         const int numChildren = node.children.size();
-        if( numChildren == 2 )
+        for( int c=0; c<numChildren; ++c )
         {
-            const int leftInd = node.children[0];
-            const int rightInd = node.children[1];
-            Matrix<F>& leftWork = L.localFronts[leftInd].work;
-            Matrix<F>& rightWork = L.localFronts[rightInd].work;
-            const int leftNodeSize = info.localNodes[leftInd].size;
-            const int rightNodeSize = info.localNodes[rightInd].size;
-            const int leftUpdateSize = leftWork.Height()-leftNodeSize;
-            const int rightUpdateSize = rightWork.Height()-rightNodeSize;
-
-            // Add the left child's update onto ours
-            auto leftUpdate = 
-                LockedView( leftWork, leftNodeSize, 0, leftUpdateSize, width );
-            for( int iChild=0; iChild<leftUpdateSize; ++iChild )
-            {
-                const int iFront = node.leftRelInds[iChild]; 
-                for( int j=0; j<width; ++j )
-                    W.Update( iFront, j, leftUpdate.Get(iChild,j) );
-            }
-            leftWork.Empty();
-
-            // Add the right child's update onto ours
-            auto rightUpdate =
+            const int childInd = node.children[c];
+            Matrix<F>& childWork = L.localFronts[childInd].work;
+            const int childNodeSize = info.localNodes[childInd].size;
+            const int childUpdateSize = childWork.Height()-childNodeSize;
+            const std::vector<int>& childRelInds = node.childRelInds[c];
+
+            // Add this child's update onto ours
+            auto childUpdate =
                 LockedView
-                ( rightWork, rightNodeSize, 0, rightUpdateSize, width );
-            for( int iChild=0; iChild<rightUpdateSize; ++iChild )
+                ( childWork, childNodeSize, 0, childUpdateSize, width );
+            for( int iChild=0; iChild<childUpdateSize; ++iChild )
             {
-                const int iFront = node.rightRelInds[iChild];
+                const int iFront = childRelInds[iChild]; 
                 for( int j=0; j<width; ++j )
-                    W.Update( iFront, j, rightUpdate.Get(iChild,j) );
+                    W.Update( iFront, j, childUpdate.Get(iChild,j) );
             }
-            rightWork.Empty();
+            childWork.Empty();
         }
-        // else numChildren == 0
 
         // Solve against this front
         if( blocked )
             FrontBlockLowerForwardSolve( frontL, W );
+        else if( selInv && pivoted )
+            FrontFastIntraPivLowerForwardSolve( frontL, front.piv, W );
+        else if( selInv )
+            FrontFastLowerForwardSolve( frontL, W );
         else if( pivoted )
             FrontIntraPivLowerForwardSolve( frontL, front.piv, W );
         else
@@ -132,6 +122,7 @@ inline void LocalLowerForwardSolve
         LogicError("Nonsensical front type for solve");
     const bool blocked = BlockFactorization( frontType );
     const bool pivoted = PivotedFactorization( frontType );
+    const bool selInv = SelInvFactorization( frontType );
 
     for( int s=0; s<numLocalNodes; ++s )
     {
@@ -149,45 +140,34 @@ inline void LocalLowerForwardSolve
 
         // Update using the children (if they exist)
         const int numChildren = node.children.size();
-        if( numChildren == 2 )
+        for( int c=0; c<numChildren; ++c )
         {
-            const int leftInd = node.children[0];
-            const int rightInd = node.children[1];
-            Matrix<F>& leftWork = L.localFronts[leftInd].work;
-            Matrix<F>& rightWork = L.localFronts[rightInd].work;
-            const int leftNodeSize = info.localNodes[leftInd].size;
-            const int rightNodeSize = info.localNodes[rightInd].size;
-            const int leftUpdateSize = leftWork.Height()-leftNodeSize;
-            const int rightUpdateSize = rightWork.Height()-rightNodeSize;
-
-            // Add the left child's update onto ours
-            auto leftUpdate =
-                LockedView( leftWork, leftNodeSize, 0, leftUpdateSize, width );
-            for( int iChild=0; iChild<leftUpdateSize; ++iChild )
-            {
-                const int iFront = node.leftRelInds[iChild]; 
-                for( int j=0; j<width; ++j )
-                    W.Update( iFront, j, leftUpdate.Get(iChild,j) );
-            }
-            leftWork.Empty();
-
-            // Add the right child's update onto ours
-            auto rightUpdate =
+            const int childInd = node.children[c];
+            Matrix<F>& childWork = L.localFronts[childInd].work;
+            const int childNodeSize = info.localNodes[childInd].size;
+            const int childUpdateSize = childWork.Height()-childNodeSize;
+            const std::vector<int>& childRelInds = node.childRelInds[c];
+
+            // Add this child's update onto ours
+            auto childUpdate =
                 LockedView
-                ( rightWork, rightNodeSize, 0, rightUpdateSize, width );
-            for( int iChild=0; iChild<rightUpdateSize; ++iChild )
+                ( childWork, childNodeSize, 0, childUpdateSize, width );
+            for( int iChild=0; iChild<childUpdateSize; ++iChild )
             {
-                const int iFront = node.rightRelInds[iChild];
+                const int iFront = childRelInds[iChild]; 
                 for( int j=0; j<width; ++j )
-                    W.Update( iFront, j, rightUpdate.Get(iChild,j) );
+                    W.Update( iFront, j, childUpdate.Get(iChild,j) );
             }
-            rightWork.Empty();
+            childWork.Empty();
         }
-        // else numChildren == 0
 
         // Solve against this front
         if( blocked )
             FrontBlockLowerForwardSolve( frontL, W );
+        else if( selInv && pivoted )
+            FrontFastIntraPivLowerForwardSolve( frontL, front.piv, W );
+        else if( selInv )
+            FrontFastLowerForwardSolve( frontL, W );
         else if( pivoted )
             FrontIntraPivLowerForwardSolve( frontL, front.piv, W );
         else
@@ -213,6 +193,7 @@ inline void LocalLowerBackwardSolve
         LogicError("Nonsensical front type for solve");
     const bool blocked = BlockFactorization( frontType );
     const bool pivoted = PivotedFactorization( frontType );
+    const bool selInv = SelInvFactorization( frontType );
 
     for( int s=numLocalNodes-2; s>=0; --s )
     {
@@ -248,7 +229,7 @@ inline void LocalLowerBackwardSolve
         const SymmNodeInfo& parentNode = info.localNodes[parent];
         const int currentUpdateSize = WB.Height();
         const std::vector<int>& parentRelInds = 
-          ( node.onLeft ? parentNode.leftRelInds : parentNode.rightRelInds );
+          parentNode.childRelInds[node.whichChild];
         for( int iCurrent=0; iCurrent<currentUpdateSize; ++iCurrent )
         {
             const int iParent = parentRelInds[iCurrent];
@@ -256,9 +237,9 @@ inline void LocalLowerBackwardSolve
                 WB.Set( iCurrent, j, parentWork.Get(iParent,j) );
         }
 
-        // The left child is numbered lower than the right child, so 
-        // we can safely free the parent's work if we are the left child
-        if( node.onLeft )
+        // The first child is numbered lower than the other children, so 
+        // we can safely free the parent's work if we are the first child
+        if( node.whichChild == 0 )
         {
             parentWork.Empty();
             if( parent == numLocalNodes-1 )
@@ -268,6 +249,11 @@ inline void LocalLowerBackwardSolve
         // Solve against this front
         if( blocked )
             FrontBlockLowerBackwardSolve( frontL, W, conjugate );
+        else if( selInv && pivoted )
+            FrontFastIntraPivLowerBackwardSolve
+            ( frontL, front.piv, W, conjugate );
+        else if( selInv )
+            FrontFastLowerBackwardSolve( frontL, W, conjugate );
         else if( pivoted )
             FrontIntraPivLowerBackwardSolve( frontL, front.piv, W, conjugate );
         else
@@ -298,6 +284,7 @@ inline void LocalLowerBackwardSolve
         LogicError("Nonsensical front type for solve");
     const bool blocked = BlockFactorization( frontType );
     const bool pivoted = PivotedFactorization( frontType );
+    const bool selInv = SelInvFactorization( frontType );
 
     for( int s=numLocalNodes-2; s>=0; --s )
     {
@@ -333,7 +320,7 @@ inline void LocalLowerBackwardSolve
         const SymmNodeInfo& parentNode = info.localNodes[parent];
         const int currentUpdateSize = WB.Height();
         const std::vector<int>& parentRelInds = 
-          ( node.onLeft ? parentNode.leftRelInds : parentNode.rightRelInds );
+          parentNode.childRelInds[node.whichChild];
         for( int iCurrent=0; iCurrent<currentUpdateSize; ++iCurrent )
         {
             const int iParent = parentRelInds[iCurrent];
@@ -341,9 +328,9 @@ inline void LocalLowerBackwardSolve
                 WB.Set( iCurrent, j, parentWork.Get(iParent,j) );
         }
 
-        // The left child is numbered lower than the right child, so 
-        // we can safely free the parent's work if we are the left child
-        if( node.onLeft )
+        // The first child is numbered lower than the other children, so 
+        // we can safely free the parent's work if we are the first child
+        if( node.whichChild == 0 )
         {
             parentWork.Empty();
             if( parent == numLocalNodes-1 )
@@ -353,6 +340,11 @@ inline void LocalLowerBackwardSolve
         // Solve against this front
         if( blocked )
             FrontBlockLowerBackwardSolve( frontL, W, conjugate );
+        else if( selInv && pivoted )
+            FrontFastIntraPivLowerBackwardSolve
+            ( frontL, front.piv, W, conjugate );
+        else if( selInv )
+            FrontFastLowerBackwardSolve( frontL, W, conjugate );
         else if( pivoted )
             FrontIntraPivLowerBackwardSolve( frontL, front.piv, W, conjugate );
         else
@@ -27,6 +27,20 @@ void FrontIntraPivLowerBackwardSolve
 ( const Matrix<F>& L, const Matrix<Int>& p, Matrix<F>& X, 
   bool conjugate=false );
 
+template<typename F>
+void FrontFastLowerForwardSolve( const Matrix<F>& L, Matrix<F>& X );
+template<typename F>
+void FrontFastIntraPivLowerForwardSolve
+( const Matrix<F>& L, const Matrix<Int>& p, Matrix<F>& X );
+
+template<typename F>
+void FrontFastLowerBackwardSolve
+( const Matrix<F>& L, Matrix<F>& X, bool conjugate=false );
+template<typename F>
+void FrontFastIntraPivLowerBackwardSolve
+( const Matrix<F>& L, const Matrix<Int>& p, Matrix<F>& X, 
+  bool conjugate=false );
+
 //----------------------------------------------------------------------------//
 // Implementation begins here                                                 //
 //----------------------------------------------------------------------------//
@@ -99,6 +113,85 @@ inline void FrontIntraPivLowerBackwardSolve
     elem::ApplyInverseRowPivots( XT, p );
 }
 
+// The following routines assume that the top (square) block of L has been
+// selectively inverted, so that the triangular solves become multiplies
+
+template<typename F>
+inline void FrontFastLowerForwardSolve( const Matrix<F>& L, Matrix<F>& X )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("FrontFastLowerForwardSolve");
+        if( L.Height() < L.Width() || L.Height() != X.Height() )
+        {
+            std::ostringstream msg;
+            msg << "Nonconformal solve:\n"
+                << "  L ~ " << L.Height() << " x " << L.Width() << "\n"
+                << "  X ~ " << X.Height() << " x " << X.Width() << "\n";
+            LogicError( msg.str() );
+        }
+    )
+    Matrix<F> LT, LB, XT, XB;
+    LockedPartitionDown( L, LT, LB, L.Width() );
+    PartitionDown( X, XT, XB, L.Width() );
+
+    // XT := inv(ATL) XT
+    elem::Trmm( LEFT, LOWER, NORMAL, UNIT, F(1), LT, XT );
+
+    // XB := XB - LB XT
+    if( LB.Height() != 0 )
+        elem::Gemm( NORMAL, NORMAL, F(-1), LB, XT, F(1), XB );
+}
+
+template<typename F>
+inline void FrontFastIntraPivLowerForwardSolve
+( const Matrix<F>& L, const Matrix<Int>& p, Matrix<F>& X )
+{
+    DEBUG_ONLY(CallStackEntry cse("FrontFastIntraPivLowerForwardSolve"))
+    Matrix<F> XT, XB;
+    PartitionDown( X, XT, XB, L.Width() );
+    elem::ApplyRowPivots( XT, p );
+    FrontFastLowerForwardSolve( L, X );
+}
+
+template<typename F>
+inline void FrontFastLowerBackwardSolve
+( const Matrix<F>& L, Matrix<F>& X, bool conjugate )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("FrontFastLowerBackwardSolve");
+        if( L.Height() < L.Width() || L.Height() != X.Height() )
+        {
+            std::ostringstream msg;
+            msg << "Nonconformal solve:\n"
+                << "  L ~ " << L.Height() << " x " << L.Width() << "\n"
+                << "  X ~ " << X.Height() << " x " << X.Width() << "\n";
+            LogicError( msg.str() );
+        }
+    )
+    Matrix<F> LT, LB, XT, XB;
+    LockedPartitionDown( L, LT, LB, L.Width() );
+    PartitionDown( X, XT, XB, L.Width() );
+
+    // XT := XT - LB^{T/H} XB
+    const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
+    if( LB.Height() != 0 )
+        elem::Gemm( orientation, NORMAL, F(-1), LB, XB, F(1), XT );
+
+    // XT := inv(ATL)^{T/H} XT
+    elem::Trmm( LEFT, LOWER, orientation, UNIT, F(1), LT, XT );
+}
+
+template<typename F>
+inline void FrontFastIntraPivLowerBackwardSolve
+( const Matrix<F>& L, const Matrix<Int>& p, Matrix<F>& X, bool conjugate )
+{
+    DEBUG_ONLY(CallStackEntry cse("FrontFastIntraPivLowerBackwardSolve"))
+    FrontFastLowerBackwardSolve( L, X, conjugate );
+    Matrix<F> XT, XB;
+    PartitionDown( X, XT, XB, L.Width() );
+    elem::ApplyInverseRowPivots( XT, p );
+}
+
 } // namespace cliq
 
 #endif // ifndef CLIQ_NUMERIC_LOWERSOLVE_LOCALFRONT_HPP
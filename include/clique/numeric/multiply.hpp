@@ -19,10 +19,146 @@ void Multiply
 ( T alpha, const DistSparseMatrix<T>& A, const DistMultiVec<T>& X,
   T beta,                                      DistMultiVec<T>& Y );
 
+// Y := alpha A X + beta Y, where A is stored with dense blocks
+template<typename T>
+void Multiply
+( T alpha, const DistBlockSparseMatrix<T>& A, const DistMultiVec<T>& X,
+  T beta,                                           DistMultiVec<T>& Y );
+
+// Y := alpha A X + beta Y, with A, X, and Y all in the nodal distribution
+template<typename T>
+void Multiply
+( T alpha, const DistNodalSparseMatrix<T>& A, const DistNodalMultiVec<T>& X,
+  T beta,                                          DistNodalMultiVec<T>& Y );
+
 //----------------------------------------------------------------------------//
 // Implementation begins here                                                 //
 //----------------------------------------------------------------------------//
 
+namespace internal {
+
+// Y(i,:) := beta Y(i,:) + alpha sum_k vals[k] X(cols[k],:), where k runs over
+// [begs[i],ends[i]) and the rows of X are stored contiguously (i.e., 
+// interleaved across the columns) so that the innermost loop is unit-stride 
+// over the right-hand sides
+template<typename T>
+inline void
+CSRMultiply
+( int numRows, T alpha, 
+  const int* begs, const int* ends, const int* cols, const T* vals,
+  const T* XBuf, int width, T beta, T* YBuf, int YLDim )
+{
+    DEBUG_ONLY(CallStackEntry cse("internal::CSRMultiply"))
+#ifdef HAVE_OPENMP
+    #pragma omp parallel
+#endif
+    {
+        std::vector<T> rowUpdate( width );
+        T* update = &rowUpdate[0];
+#ifdef HAVE_OPENMP
+        #pragma omp for schedule(static)
+#endif
+        for( int i=0; i<numRows; ++i )
+        {
+            for( int j=0; j<width; ++j )
+                update[j] = 0;
+            const int end = ends[i];
+            for( int k=begs[i]; k<end; ++k )
+            {
+                const T AVal = vals[k];
+                const T* XRow = &XBuf[cols[k]*width];
+                for( int j=0; j<width; ++j )
+                    update[j] += AVal*XRow[j];
+            }
+            for( int j=0; j<width; ++j )
+                YBuf[i+j*YLDim] = alpha*update[j] + beta*YBuf[i+j*YLDim];
+        }
+    }
+}
+
+// Post the nonblocking sends and receives for exchanging rows of width 
+// 'width' with the processes that we share a nonzero number of rows with
+template<typename T>
+inline void
+StartRowExchange
+( const T* sendBuf, 
+  const std::vector<int>& sendSizes, const std::vector<int>& sendOffs,
+        T* recvBuf,
+  const std::vector<int>& recvSizes, const std::vector<int>& recvOffs,
+  int width, mpi::Comm comm, std::vector<mpi::Request>& requests )
+{
+    DEBUG_ONLY(CallStackEntry cse("internal::StartRowExchange"))
+    const int commSize = mpi::CommSize( comm );
+    int numRequests=0;
+    for( int q=0; q<commSize; ++q )
+    {
+        if( recvSizes[q] != 0 )
+            ++numRequests;
+        if( sendSizes[q] != 0 )
+            ++numRequests;
+    }
+    requests.resize( numRequests );
+    int rCount=0;
+    for( int q=0; q<commSize; ++q )
+    {
+        const int count = recvSizes[q]*width;
+        if( count != 0 )
+            mpi::IRecv
+            ( &recvBuf[recvOffs[q]*width], count, q, comm, 
+              requests[rCount++] );
+    }
+    for( int q=0; q<commSize; ++q )
+    {
+        const int count = sendSizes[q]*width;
+        if( count != 0 )
+            mpi::ISend
+            ( &sendBuf[sendOffs[q]*width], count, q, comm, 
+              requests[rCount++] );
+    }
+}
+
+inline void
+FinishRowExchange( std::vector<mpi::Request>& requests )
+{
+    DEBUG_ONLY(CallStackEntry cse("internal::FinishRowExchange"))
+    const int numRequests = requests.size();
+    if( numRequests != 0 )
+    {
+        std::vector<mpi::Status> statuses( numRequests );
+        mpi::WaitAll( numRequests, &requests[0], &statuses[0] );
+    }
+}
+
+// Y(cols[k],:) += alpha op(vals[k]) X(i,:) for each k in [begs[i],ends[i]),
+// where op is either the identity or conjugation and the rows of X and Y are
+// stored contiguously. If requested, entries with cols[k] == i are skipped.
+template<typename T>
+inline void
+CSRTransposeMultiply
+( int numRows, T alpha, bool conjugate,
+  const int* begs, const int* ends, const int* cols, const T* vals,
+  const T* XBuf, int width, T* YBuf, bool skipDiagonal )
+{
+    DEBUG_ONLY(CallStackEntry cse("internal::CSRTransposeMultiply"))
+    for( int i=0; i<numRows; ++i )
+    {
+        const T* XRow = &XBuf[i*width];
+        const int end = ends[i];
+        for( int k=begs[i]; k<end; ++k )
+        {
+            const int col = cols[k];
+            if( skipDiagonal && col == i )
+                continue;
+            const T AVal = alpha*( conjugate ? elem::Conj(vals[k]) : vals[k] );
+            T* YRow = &YBuf[col*width];
+            for( int j=0; j<width; ++j )
+                YRow[j] += AVal*XRow[j];
+        }
+    }
+}
+
+} // namespace internal
+
 template<typename T>
 void Multiply
 ( T alpha, const DistSparseMatrix<T>& A, const DistMultiVec<T>& X,
@@ -42,50 +178,75 @@ void Multiply
     const int YLocalHeight = Y.LocalHeight();
     const int width = X.Width();
     const int numLocalEntries = A.NumLocalEntries();
-
-    // Y := beta Y
-    for( int j=0; j<width; ++j )
-        for( int iLocal=0; iLocal<YLocalHeight; ++iLocal )
-            Y.SetLocal( iLocal, j, beta*Y.GetLocal(iLocal,j) );
+    const int firstLocalRow = A.FirstLocalRow();
+    const int lastLocalRow = firstLocalRow + X.LocalHeight();
 
     SparseMultMeta<T>& meta = A.multMeta;
     if( !meta.ready )
     {
-        // Compute the set of row indices that we need from X
-        std::set<int> indexSet;
-        for( int e=0; e<numLocalEntries; ++e )
-            indexSet.insert( A.Col(e) );
-        const int numRecvInds = indexSet.size();
-        std::vector<int> recvInds( numRecvInds );
-        meta.recvSizes.clear();
-        meta.recvSizes.resize( commSize, 0 );
-        meta.recvOffs.resize( commSize );
-        const int blocksize = A.Blocksize();
+        // Since the columns of each row are sorted, the locally-owned columns
+        // form a contiguous range of each row. Set their offsets directly and
+        // queue up the (column,entry) pairs of the remaining ghost entries.
+        const int* rowOffs = A.LockedOffsetBuffer();
+        const int* cols = A.LockedTargetBuffer();
+        meta.rowOffs.resize( YLocalHeight+1 );
+        meta.colOffs.resize( numLocalEntries );
+        meta.localBegs.resize( YLocalHeight );
+        meta.localEnds.resize( YLocalHeight );
+        std::vector<std::pair<int,int> > ghosts;
+        for( int iLocal=0; iLocal<YLocalHeight; ++iLocal )
         {
-            int off=0, lastOff=0, qPrev=0;
-            std::set<int>::const_iterator setIt;
-            for( setIt=indexSet.begin(); setIt!=indexSet.end(); ++setIt )
+            const int off = rowOffs[iLocal];
+            const int offNext = rowOffs[iLocal+1];
+            int localBeg=off, localEnd=off;
+            for( int k=off; k<offNext; ++k )
             {
-                const int j = *setIt;
-                const int q = RowToProcess( j, blocksize, commSize );
-                while( qPrev != q )
+                const int j = cols[k];
+                if( j < firstLocalRow )
+                {
+                    ghosts.push_back( std::pair<int,int>(j,k) );
+                    localBeg = localEnd = k+1;
+                }
+                else if( j < lastLocalRow )
                 {
-                    meta.recvSizes[qPrev] = off - lastOff;
-                    meta.recvOffs[qPrev+1] = off;
-    
-                    lastOff = off;
-                    ++qPrev;
+                    meta.colOffs[k] = j - firstLocalRow;
+                    localEnd = k+1;
                 }
-                recvInds[off++] = j;
+                else
+                    ghosts.push_back( std::pair<int,int>(j,k) );
             }
-            while( qPrev != commSize-1 )
+            meta.rowOffs[iLocal] = off;
+            meta.localBegs[iLocal] = localBeg;
+            meta.localEnds[iLocal] = localEnd;
+        }
+        meta.rowOffs[YLocalHeight] = numLocalEntries;
+
+        // Sorting the ghost entries by column yields the unique ghost 
+        // indices, grouped by owning process, in a single pass
+        std::sort( ghosts.begin(), ghosts.end() );
+        const int numGhosts = ghosts.size();
+        const int blocksize = A.Blocksize();
+        meta.recvInds.clear();
+        meta.recvSizes.clear();
+        meta.recvSizes.resize( commSize, 0 );
+        for( int g=0; g<numGhosts; ++g )
+        {
+            const int j = ghosts[g].first;
+            if( g == 0 || j != ghosts[g-1].first )
             {
-                meta.recvSizes[qPrev] = off - lastOff;
-                meta.recvOffs[qPrev+1] = off;
-                lastOff = off;
-                ++qPrev;
+                meta.recvInds.push_back( j );
+                ++meta.recvSizes[RowToProcess( j, blocksize, commSize )];
             }
-            meta.recvSizes[commSize-1] = off - lastOff;
+            meta.colOffs[ghosts[g].second] = meta.recvInds.size()-1;
+        }
+        SwapClear( ghosts );
+        const int numRecvInds = meta.recvInds.size();
+        meta.recvOffs.resize( commSize );
+        int numRecvs=0;
+        for( int q=0; q<commSize; ++q )
+        {
+            meta.recvOffs[q] = numRecvs;
+            numRecvs += meta.recvSizes[q];
         }
 
         // Coordinate
@@ -100,68 +261,398 @@ void Multiply
         }
         meta.sendInds.resize( numSendInds );
         mpi::AllToAll
-        ( &recvInds[0],       &meta.recvSizes[0], &meta.recvOffs[0],
+        ( &meta.recvInds[0], &meta.recvSizes[0], &meta.recvOffs[0],
           &meta.sendInds[0], &meta.sendSizes[0], &meta.sendOffs[0], comm );
-
-        meta.colOffs.resize( numLocalEntries );
-        for( int s=0; s<numLocalEntries; ++s )
-            meta.colOffs[s] = Find( recvInds, A.Col(s) );
         meta.numRecvInds = numRecvInds;
         meta.ready = true;
     }
 
-    // Convert the sizes and offsets to be compatible with the current width
-    std::vector<int> recvSizes=meta.recvSizes,
-                     recvOffs=meta.recvOffs,
-                     sendSizes=meta.sendSizes,
-                     sendOffs=meta.sendOffs;
-    for( int q=0; q<commSize; ++q )
-    {
-        recvSizes[q] *= width;    
-        recvOffs[q] *= width;
-        sendSizes[q] *= width;
-        sendOffs[q] *= width;
-    }
-
-    // Pack the send values
+    // Interleave our local rows of X and pack the send values
+    const int XLocalHeight = X.LocalHeight();
+    const int XLDim = X.LDim();
+    const T* XBuf = X.LockedBuffer();
+    std::vector<T> XLocal( XLocalHeight*width );
+    for( int iLocal=0; iLocal<XLocalHeight; ++iLocal )
+        for( int j=0; j<width; ++j )
+            XLocal[iLocal*width+j] = XBuf[iLocal+j*XLDim];
     const int numSendInds = meta.sendInds.size();
-    const int firstLocalRow = A.FirstLocalRow();
     std::vector<T> sendVals( numSendInds*width );
     for( int s=0; s<numSendInds; ++s )
     {
         const int i = meta.sendInds[s];
         const int iLocal = i - firstLocalRow;
         DEBUG_ONLY(
-            if( iLocal < 0 || iLocal >= X.LocalHeight() )
+            if( iLocal < 0 || iLocal >= XLocalHeight )
                 LogicError("iLocal was out of bounds");
         )
         for( int j=0; j<width; ++j )
-            sendVals[s*width+j] = X.GetLocal( iLocal, j );
+            sendVals[s*width+j] = XLocal[iLocal*width+j];
     }
 
-    // Now send them
+    // Start exchanging the ghost values (we never need to send to ourself)
     std::vector<T> recvVals( meta.numRecvInds*width );
-    mpi::AllToAll
-    ( &sendVals[0], &sendSizes[0], &sendOffs[0],
-      &recvVals[0], &recvSizes[0], &recvOffs[0], comm );
+    std::vector<mpi::Request> requests;
+    internal::StartRowExchange
+    ( &sendVals[0], meta.sendSizes, meta.sendOffs,
+      &recvVals[0], meta.recvSizes, meta.recvOffs, width, comm, requests );
      
-    // Perform the local multiply-accumulate, y := alpha A x + y
-    for( int iLocal=0; iLocal<YLocalHeight; ++iLocal )
+    // Y := alpha A_local X + beta Y, where A_local is restricted to the 
+    // locally-owned columns, while the ghost values are in flight
+    const int* rowOffs = A.LockedOffsetBuffer();
+    const T* vals = A.LockedValueBuffer();
+    T* YBuf = Y.Buffer();
+    const int YLDim = Y.LDim();
+    internal::CSRMultiply
+    ( YLocalHeight, alpha, &meta.localBegs[0], &meta.localEnds[0], 
+      &meta.colOffs[0], vals, &XLocal[0], width, beta, YBuf, YLDim );
+
+    // With lower storage, the strictly upper triangle is applied as the
+    // (conjugate-)transpose of the strictly lower triangle. The contributions
+    // to locally-owned rows are formed immediately, and those to ghost rows 
+    // are accumulated and then sent back to their owners.
+    const bool lowerStorage = A.LowerStorage();
+    const bool conjugate = A.ConjugateStorage();
+    std::vector<T> ghostUpdates, ownerUpdates;
+    if( lowerStorage )
+    {
+        std::vector<T> YLocal( YLocalHeight*width, T(0) );
+        internal::CSRTransposeMultiply
+        ( YLocalHeight, alpha, conjugate, &meta.localBegs[0], 
+          &meta.localEnds[0], &meta.colOffs[0], vals, &XLocal[0], width, 
+          &YLocal[0], true );
+        for( int iLocal=0; iLocal<YLocalHeight; ++iLocal )
+            for( int j=0; j<width; ++j )
+                YBuf[iLocal+j*YLDim] += YLocal[iLocal*width+j];
+        SwapClear( YLocal );
+
+        ghostUpdates.resize( meta.numRecvInds*width, T(0) );
+        internal::CSRTransposeMultiply
+        ( YLocalHeight, alpha, conjugate, rowOffs, &meta.localBegs[0],
+          &meta.colOffs[0], vals, &XLocal[0], width, &ghostUpdates[0], 
+          false );
+        internal::CSRTransposeMultiply
+        ( YLocalHeight, alpha, conjugate, &meta.localEnds[0], rowOffs+1,
+          &meta.colOffs[0], vals, &XLocal[0], width, &ghostUpdates[0], 
+          false );
+    }
+
+    // Finish the exchange (and start the reverse exchange of the transposed 
+    // contributions) and then handle the ghost columns, which lie before
+    // and after the locally-owned columns of each row
+    internal::FinishRowExchange( requests );
+    SwapClear( sendVals );
+    SwapClear( XLocal );
+    if( lowerStorage )
+    {
+        ownerUpdates.resize( meta.sendInds.size()*width );
+        internal::StartRowExchange
+        ( &ghostUpdates[0], meta.recvSizes, meta.recvOffs,
+          &ownerUpdates[0], meta.sendSizes, meta.sendOffs, width, comm, 
+          requests );
+    }
+    internal::CSRMultiply
+    ( YLocalHeight, alpha, rowOffs, &meta.localBegs[0],
+      &meta.colOffs[0], vals, &recvVals[0], width, T(1), YBuf, YLDim );
+    internal::CSRMultiply
+    ( YLocalHeight, alpha, &meta.localEnds[0], rowOffs+1,
+      &meta.colOffs[0], vals, &recvVals[0], width, T(1), YBuf, YLDim );
+    if( lowerStorage )
     {
-        const int off = A.LocalEntryOffset( iLocal );
-        const int rowSize = A.NumConnections( iLocal );
-        for( int k=0; k<rowSize; ++k )
+        internal::FinishRowExchange( requests );
+        for( int s=0; s<numSendInds; ++s )
         {
-            const int colOff = meta.colOffs[k+off];
-            const T AVal = A.Value(k+off);
+            const int iLocal = meta.sendInds[s] - firstLocalRow;
             for( int j=0; j<width; ++j )
+                YBuf[iLocal+j*YLDim] += ownerUpdates[s*width+j];
+        }
+    }
+}
+
+template<typename T>
+void Multiply
+( T alpha, const DistBlockSparseMatrix<T>& A, const DistMultiVec<T>& X,
+  T beta,                                           DistMultiVec<T>& Y )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("Multiply");
+        if( A.Height() != Y.Height() || A.Width() != X.Height() || 
+            X.Width() != Y.Width() )
+            LogicError("A, X, and Y did not conform");
+        if( !mpi::CongruentComms( A.Comm(), X.Comm() ) || 
+            !mpi::CongruentComms( X.Comm(), Y.Comm() ) )
+            LogicError("Communicators did not match");
+    )
+    mpi::Comm comm = A.Comm();
+    const int commSize = mpi::CommSize( comm );
+    const int width = X.Width();
+    const int blockDim = A.BlockDim();
+    const int numBlockEntries = blockDim*blockDim;
+    const int localBlockHeight = A.LocalBlockHeight();
+    const int numLocalBlocks = A.NumLocalBlocks();
+    const DistGraph& graph = A.LockedDistGraph();
+    const int* rowOffs = graph.LockedOffsetBuffer();
+
+    // The block rows are distributed differently than the scalar rows of X 
+    // and Y, so every needed row of X is gathered and the rows of A X that 
+    // we compute are sent to the owners of the corresponding rows of Y
+    SparseMultMeta<T>& meta = A.multMeta;
+    if( !meta.ready )
+    {
+        // Sorting the (block column,block) pairs yields the unique block 
+        // columns, and thus the needed rows of X, in ascending order
+        const int* blockCols = graph.LockedTargetBuffer();
+        std::vector<std::pair<int,int> > pairs( numLocalBlocks );
+        for( int k=0; k<numLocalBlocks; ++k )
+            pairs[k] = std::pair<int,int>( blockCols[k], k );
+        std::sort( pairs.begin(), pairs.end() );
+        const int XBlocksize = X.Blocksize();
+        meta.recvInds.clear();
+        meta.recvSizes.clear();
+        meta.recvSizes.resize( commSize, 0 );
+        meta.colOffs.resize( numLocalBlocks );
+        for( int k=0; k<numLocalBlocks; ++k )
+        {
+            const int J = pairs[k].first;
+            if( k == 0 || J != pairs[k-1].first )
+            {
+                for( int c=0; c<blockDim; ++c )
+                {
+                    const int j = J*blockDim + c;
+                    meta.recvInds.push_back( j );
+                    ++meta.recvSizes[RowToProcess( j, XBlocksize, commSize )];
+                }
+            }
+            meta.colOffs[pairs[k].second] = meta.recvInds.size()-blockDim;
+        }
+        SwapClear( pairs );
+        const int numRecvInds = meta.recvInds.size();
+        meta.recvOffs.resize( commSize );
+        int numRecvs=0;
+        for( int q=0; q<commSize; ++q )
+        {
+            meta.recvOffs[q] = numRecvs;
+            numRecvs += meta.recvSizes[q];
+        }
+
+        // Coordinate
+        meta.sendSizes.resize( commSize );
+        mpi::AllToAll( &meta.recvSizes[0], 1, &meta.sendSizes[0], 1, comm );
+        int numSendInds=0;
+        meta.sendOffs.resize( commSize );
+        for( int q=0; q<commSize; ++q )
+        {
+            meta.sendOffs[q] = numSendInds;
+            numSendInds += meta.sendSizes[q];
+        }
+        meta.sendInds.resize( numSendInds );
+        mpi::AllToAll
+        ( &meta.recvInds[0], &meta.recvSizes[0], &meta.recvOffs[0],
+          &meta.sendInds[0], &meta.sendSizes[0], &meta.sendOffs[0], comm );
+        meta.numRecvInds = numRecvInds;
+        meta.ready = true;
+    }
+
+    // Pack and exchange the needed rows of X
+    const int XFirstLocalRow = X.FirstLocalRow();
+    const int XLDim = X.LDim();
+    const T* XBuf = X.LockedBuffer();
+    const int numSendInds = meta.sendInds.size();
+    std::vector<T> sendVals( numSendInds*width );
+    for( int s=0; s<numSendInds; ++s )
+    {
+        const int iLocal = meta.sendInds[s] - XFirstLocalRow;
+        for( int j=0; j<width; ++j )
+            sendVals[s*width+j] = XBuf[iLocal+j*XLDim];
+    }
+    std::vector<T> recvVals( meta.numRecvInds*width );
+    std::vector<mpi::Request> requests;
+    internal::StartRowExchange
+    ( &sendVals[0], meta.sendSizes, meta.sendOffs,
+      &recvVals[0], meta.recvSizes, meta.recvOffs, width, comm, requests );
+    internal::FinishRowExchange( requests );
+    SwapClear( sendVals );
+
+    // Z := A X for our block rows, using dense block kernels
+    const int ZHeight = localBlockHeight*blockDim;
+    std::vector<T> Z( ZHeight*width, T(0) );
+    const T* blockBuf = ( numLocalBlocks==0 ? 0 : A.LockedBlockBuffer(0) );
+#ifdef HAVE_OPENMP
+    #pragma omp parallel for schedule(static)
+#endif
+    for( int ILocal=0; ILocal<localBlockHeight; ++ILocal )
+    {
+        T* ZBlock = &Z[ILocal*blockDim*width];
+        for( int k=rowOffs[ILocal]; k<rowOffs[ILocal+1]; ++k )
+        {
+            const T* B = &blockBuf[k*numBlockEntries];
+            const T* XBlock = &recvVals[meta.colOffs[k]*width];
+            for( int c=0; c<blockDim; ++c )
             {
-                const T XVal = recvVals[colOff*width+j];
-                const T update = alpha*AVal*XVal;
-                Y.UpdateLocal( iLocal, j, update );
+                const T* XRow = &XBlock[c*width];
+                for( int r=0; r<blockDim; ++r )
+                {
+                    const T BVal = B[r+c*blockDim];
+                    T* ZRow = &ZBlock[r*width];
+                    for( int j=0; j<width; ++j )
+                        ZRow[j] += BVal*XRow[j];
+                }
             }
         }
     }
+    SwapClear( recvVals );
+
+    // Send the rows of Z to the owners of the corresponding rows of Y. Since
+    // both distributions assign contiguous ranges of rows in process order,
+    // the received rows are simply our local rows of Y, in order.
+    const int height = A.Height();
+    const int YBlocksize = Y.Blocksize();
+    const int blockRowBlocksize = graph.Blocksize();
+    const int numBlockRows = A.NumBlockRows();
+    const int ZFirstRow = A.FirstLocalBlockRow()*blockDim;
+    const int YFirstRow = Y.FirstLocalRow();
+    const int YLocalHeight = Y.LocalHeight();
+    std::vector<int> sendSizes( commSize ), sendOffs( commSize ),
+                     recvSizes( commSize ), recvOffs( commSize );
+    int numSends=0, numRecvs=0;
+    for( int q=0; q<commSize; ++q )
+    {
+        // The rows of Y owned by process q
+        const int YBeg = q*YBlocksize;
+        const int YEnd = ( q<commSize-1 ? YBeg+YBlocksize : height );
+        // The rows of Z computed by process q
+        const int ZBeg = q*blockRowBlocksize*blockDim;
+        const int ZEnd = 
+            ( q<commSize-1 ? ZBeg+blockRowBlocksize*blockDim 
+                           : numBlockRows*blockDim );
+
+        sendSizes[q] = 
+            std::max
+            ( std::min(YEnd,ZFirstRow+ZHeight)-std::max(YBeg,ZFirstRow), 0 );
+        recvSizes[q] = 
+            std::max
+            ( std::min(ZEnd,YFirstRow+YLocalHeight)-std::max(ZBeg,YFirstRow), 
+              0 );
+        sendOffs[q] = numSends;
+        recvOffs[q] = numRecvs;
+        numSends += sendSizes[q];
+        numRecvs += recvSizes[q];
+    }
+    DEBUG_ONLY(
+        if( numSends != ZHeight || numRecvs != YLocalHeight )
+            LogicError("Invalid redistribution of the product");
+    )
+    std::vector<T> YRecv( YLocalHeight*width );
+    internal::StartRowExchange
+    ( &Z[0], sendSizes, sendOffs, &YRecv[0], recvSizes, recvOffs, 
+      width, comm, requests );
+    internal::FinishRowExchange( requests );
+    SwapClear( Z );
+
+    // Y := alpha (A X) + beta Y
+    T* YBuf = Y.Buffer();
+    const int YLDim = Y.LDim();
+    for( int j=0; j<width; ++j )
+        for( int iLocal=0; iLocal<YLocalHeight; ++iLocal )
+            YBuf[iLocal+j*YLDim] = 
+                alpha*YRecv[iLocal*width+j] + beta*YBuf[iLocal+j*YLDim];
+}
+
+template<typename T>
+void Multiply
+( T alpha, const DistNodalSparseMatrix<T>& A, const DistNodalMultiVec<T>& X,
+  T beta,                                          DistNodalMultiVec<T>& Y )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("Multiply");
+        if( A.Height() != Y.Height() || A.Width() != X.Height() || 
+            X.Width() != Y.Width() )
+            LogicError("A, X, and Y did not conform");
+        if( A.LocalHeight() != X.LocalHeight() || 
+            A.LocalHeight() != Y.LocalHeight() )
+            LogicError("A, X, and Y did not have the same nodal distribution");
+        if( !A.multMeta.ready )
+            LogicError("A was not properly redistributed");
+    )
+    mpi::Comm comm = A.Comm();
+    const int width = X.Width();
+    const int localHeight = A.LocalHeight();
+    const int numLocal = X.localNodes.size();
+    const int numDist = X.distNodes.size();
+    const SparseMultMeta<T>& meta = A.multMeta;
+
+    // Interleave our local rows of X and gather our local rows of Y into 
+    // contiguous buffers
+    std::vector<T> XLocal( localHeight*width ), YLocal( localHeight*width );
+    int off=0;
+    for( int s=0; s<numLocal+numDist; ++s )
+    {
+        const Matrix<T>& XNode = 
+            ( s<numLocal ? X.localNodes[s]
+                         : X.distNodes[s-numLocal].LockedMatrix() );
+        const Matrix<T>& YNode = 
+            ( s<numLocal ? Y.localNodes[s]
+                         : Y.distNodes[s-numLocal].LockedMatrix() );
+        const int nodeHeight = XNode.Height();
+        const T* XBuf = XNode.LockedBuffer();
+        const T* YBuf = YNode.LockedBuffer();
+        const int XLDim = XNode.LDim();
+        const int YLDim = YNode.LDim();
+        for( int j=0; j<width; ++j )
+            for( int iLocal=0; iLocal<nodeHeight; ++iLocal )
+            {
+                XLocal[(off+iLocal)*width+j] = XBuf[iLocal+j*XLDim];
+                YLocal[(off+iLocal)+j*localHeight] = YBuf[iLocal+j*YLDim];
+            }
+        off += nodeHeight;
+    }
+
+    // Pack the send values and start exchanging the ghost values
+    const int numSendInds = meta.sendInds.size();
+    std::vector<T> sendVals( numSendInds*width );
+    for( int s=0; s<numSendInds; ++s )
+    {
+        const int iLocal = meta.sendInds[s];
+        for( int j=0; j<width; ++j )
+            sendVals[s*width+j] = XLocal[iLocal*width+j];
+    }
+    std::vector<T> recvVals( meta.numRecvInds*width );
+    std::vector<mpi::Request> requests;
+    internal::StartRowExchange
+    ( &sendVals[0], meta.sendSizes, meta.sendOffs,
+      &recvVals[0], meta.recvSizes, meta.recvOffs, width, comm, requests );
+
+    // Y := alpha A_owned X + beta Y, where A_owned is restricted to the 
+    // columns which we own, while the ghost values are in flight
+    const T* vals = A.LockedValueBuffer();
+    internal::CSRMultiply
+    ( localHeight, alpha, &meta.localBegs[0], &meta.localEnds[0], 
+      &meta.colOffs[0], vals, &XLocal[0], width, beta, 
+      &YLocal[0], localHeight );
+    SwapClear( XLocal );
+
+    // Finish the exchange and apply the ghost columns
+    internal::FinishRowExchange( requests );
+    SwapClear( sendVals );
+    internal::CSRMultiply
+    ( localHeight, alpha, &meta.localEnds[0], &meta.rowOffs[1], 
+      &meta.colOffs[0], vals, &recvVals[0], width, T(1), 
+      &YLocal[0], localHeight );
+    SwapClear( recvVals );
+
+    // Scatter the result back into the nodes of Y
+    off = 0;
+    for( int s=0; s<numLocal+numDist; ++s )
+    {
+        Matrix<T>& YNode = 
+            ( s<numLocal ? Y.localNodes[s] : Y.distNodes[s-numLocal].Matrix() );
+        const int nodeHeight = YNode.Height();
+        T* YBuf = YNode.Buffer();
+        const int YLDim = YNode.LDim();
+        for( int j=0; j<width; ++j )
+            for( int iLocal=0; iLocal<nodeHeight; ++iLocal )
+                YBuf[iLocal+j*YLDim] = YLocal[(off+iLocal)+j*localHeight];
+        off += nodeHeight;
+    }
 }
 
 } // namespace cliq
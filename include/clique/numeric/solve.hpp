@@ -94,21 +94,10 @@ inline void SymmetricSolve
   bool sequential, int numDistSeps, int numSeqSeps, int cutoff )
 {
     DEBUG_ONLY(CallStackEntry cse("SymmetricSolve"))
-    DistSymmInfo info;
-    DistSeparatorTree sepTree;
-    DistMap map, inverseMap;
-    NestedDissection
-    ( A.LockedDistGraph(), map, sepTree, info, 
+    DistSymmSolver<F> solver
+    ( A, conjugate, LDL_INTRAPIV_1D, 
       sequential, numDistSeps, numSeqSeps, cutoff );
-    map.FormInverse( inverseMap );
-
-    DistSymmFrontTree<F> frontTree( A, map, sepTree, info, conjugate );
-    LDL( info, frontTree, LDL_INTRAPIV_1D );
-
-    DistNodalMultiVec<F> XNodal;
-    XNodal.Pull( inverseMap, info, X );
-    Solve( info, frontTree, XNodal );
-    XNodal.Push( inverseMap, info, X );
+    solver.Solve( X );
 }
 
 template<typename F>
@@ -26,12 +26,13 @@ struct SymmNodeInfo
     //
     // The following is computed during analysis
     //
-    bool onLeft;
+    int whichChild; // our index in the parent's list of children
     int myOff;
     std::vector<int> lowerStruct;
     std::vector<int> origLowerRelInds;
+    // The relative indices of each child
     // (maps from the child update indices to our frontal indices).
-    std::vector<int> leftRelInds, rightRelInds;
+    std::vector<std::vector<int> > childRelInds;
 };
 
 struct FactorCommMeta
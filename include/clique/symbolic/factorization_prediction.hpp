@@ -0,0 +1,186 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, and Stanford University
+   All rights reserved.
+ 
+   This file is part of Clique and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef CLIQ_SYMBOLIC_FACTORIZATIONPREDICTION_HPP
+#define CLIQ_SYMBOLIC_FACTORIZATIONPREDICTION_HPP
+
+namespace cliq {
+
+// Predicted costs of a (2d) multifrontal LDL factorization for one process
+struct FactorizationPrediction
+{
+    // Entries of the frontal matrices (and their diagonals), which are 
+    // allocated before and kept after the factorization
+    double factorEntries;
+    // The maximum number of entries simultaneously allocated for the fronts, 
+    // the update matrices, and the buffers for passing the updates
+    double peakEntries;
+    double flops;
+    // Entries (and nonempty messages) sent while passing the updates
+    double sentEntries;
+    double numMessages;
+};
+
+// Collectively predict the per-process costs of the factorization described
+// by the symbolic analysis before any fronts are allocated. The maximum and 
+// minimum are over all processes, and the global values are their sums.
+template<typename F>
+void PredictFactorization
+( const DistSymmInfo& info, 
+  FactorizationPrediction& local, 
+  FactorizationPrediction& minimum, 
+  FactorizationPrediction& maximum,
+  FactorizationPrediction& global, bool selInv=false );
+
+//----------------------------------------------------------------------------//
+// Implementation begins here                                                 //
+//----------------------------------------------------------------------------//
+
+template<typename F>
+inline void
+PredictFactorization
+( const DistSymmInfo& info, 
+  FactorizationPrediction& local, 
+  FactorizationPrediction& minimum, 
+  FactorizationPrediction& maximum,
+  FactorizationPrediction& global, bool selInv )
+{
+    DEBUG_ONLY(CallStackEntry cse("PredictFactorization"))
+    local.factorEntries = local.flops = 0;
+    local.sentEntries = local.numMessages = 0;
+
+    // The fronts are all allocated (and filled) before factoring
+    const int numLocalNodes = info.localNodes.size();
+    for( int s=0; s<numLocalNodes; ++s )
+    {
+        const SymmNodeInfo& node = info.localNodes[s];
+        const double m = node.size + node.lowerStruct.size();
+        const double n = node.size;
+        local.factorEntries += m*n + n;
+        local.flops += (1./3.)*n*n*n; // n x n LDL
+        local.flops += (m-n)*n*n; // n x n trsv, m-n r.h.s.
+        local.flops += (m-n)*(m-n)*n; // (m-n) x (m-n), rank-n
+    }
+    const int numDistNodes = info.distNodes.size();
+    for( int s=1; s<numDistNodes; ++s )
+    {
+        const DistSymmNodeInfo& node = info.distNodes[s];
+        const Grid& grid = *node.grid;
+        const int m = node.size + node.lowerStruct.size();
+        const int n = node.size;
+        const double pFront = grid.Size();
+        local.factorEntries += 
+            double(Length(m,grid.Row(),grid.Height()))*
+            double(Length(n,grid.Col(),grid.Width())) + 
+            Length(n,grid.VCRank(),grid.Size());
+        local.flops += (1./3.)*n*n*n/pFront;
+        local.flops += double(m-n)*n*n/pFront;
+        local.flops += double(m-n)*(m-n)*n/pFront;
+        if( selInv )
+            local.flops += (1./3.)*n*n*n/pFront;
+    }
+
+    // Walk the local tree, where each node's update matrix is allocated 
+    // before the updates of its children are freed
+    double updateEntries=0, peakUpdateEntries=0;
+    for( int s=0; s<numLocalNodes; ++s )
+    {
+        const SymmNodeInfo& node = info.localNodes[s];
+        const double u = node.lowerStruct.size();
+        updateEntries += u*u;
+        peakUpdateEntries = std::max( peakUpdateEntries, updateEntries );
+        const int numChildren = node.children.size();
+        for( int c=0; c<numChildren; ++c )
+        {
+            const double uChild = 
+                info.localNodes[node.children[c]].lowerStruct.size();
+            updateEntries -= uChild*uChild;
+        }
+    }
+
+    // Each distributed node packs its child's update into a send buffer, 
+    // frees the child's update, exchanges the buffer, and then allocates its
+    // own update before unpacking (and freeing) the received entries
+    double childUpdateEntries = updateEntries;
+    for( int s=1; s<numDistNodes; ++s )
+    {
+        const DistSymmNodeInfo& node = info.distNodes[s];
+        const Grid& grid = *node.grid;
+        const int n = node.size;
+        const int u = node.lowerStruct.size();
+        const FactorCommMeta& commMeta = node.factorMeta;
+        mpi::Comm teamComm = grid.VCComm();
+        const int teamSize = mpi::CommSize( teamComm );
+        std::vector<int> recvSizes( teamSize );
+        mpi::AllToAll
+        ( &commMeta.numChildSendInds[0], 1, &recvSizes[0], 1, teamComm );
+        double sendEntries=0, recvEntries=0;
+        for( int q=0; q<teamSize; ++q )
+        {
+            sendEntries += commMeta.numChildSendInds[q];
+            recvEntries += recvSizes[q];
+            if( commMeta.numChildSendInds[q] != 0 )
+                ++local.numMessages;
+        }
+        local.sentEntries += sendEntries;
+
+        const int colShift = Shift( grid.Row(), n % grid.Height(), 
+                                    grid.Height() );
+        const int rowShift = Shift( grid.Col(), n % grid.Width(), 
+                                    grid.Width() );
+        const double nodeUpdateEntries = 
+            double(Length(u,colShift,grid.Height()))*
+            double(Length(u,rowShift,grid.Width()));
+        peakUpdateEntries = 
+            std::max
+            ( peakUpdateEntries, 
+              std::max
+              ( childUpdateEntries+sendEntries, 
+                std::max
+                ( sendEntries+recvEntries, recvEntries+nodeUpdateEntries ) ) );
+        childUpdateEntries = nodeUpdateEntries;
+    }
+    local.peakEntries = local.factorEntries + peakUpdateEntries;
+
+    // Since there are equal numbers of multiplies and adds, and the former
+    // takes 6 times as much work in standard complex arithmetic, while the 
+    // later only takes twice, the average is 4x more work
+    if( elem::IsComplex<F>::val )
+        local.flops *= 4;
+
+    mpi::Comm comm = info.distNodes.back().comm;
+    const int numStats = 5;
+    double localStats[numStats] = 
+        { local.factorEntries, local.peakEntries, local.flops, 
+          local.sentEntries, local.numMessages };
+    double minStats[numStats], maxStats[numStats], globalStats[numStats];
+    mpi::AllReduce( localStats, minStats, numStats, mpi::MIN, comm );
+    mpi::AllReduce( localStats, maxStats, numStats, mpi::MAX, comm );
+    mpi::AllReduce( localStats, globalStats, numStats, mpi::SUM, comm );
+    minimum.factorEntries = minStats[0];
+    minimum.peakEntries = minStats[1];
+    minimum.flops = minStats[2];
+    minimum.sentEntries = minStats[3];
+    minimum.numMessages = minStats[4];
+    maximum.factorEntries = maxStats[0];
+    maximum.peakEntries = maxStats[1];
+    maximum.flops = maxStats[2];
+    maximum.sentEntries = maxStats[3];
+    maximum.numMessages = maxStats[4];
+    global.factorEntries = globalStats[0];
+    global.peakEntries = globalStats[1];
+    global.flops = globalStats[2];
+    global.sentEntries = globalStats[3];
+    global.numMessages = globalStats[4];
+}
+
+} // namespace cliq
+
+#endif // ifndef CLIQ_SYMBOLIC_FACTORIZATIONPREDICTION_HPP
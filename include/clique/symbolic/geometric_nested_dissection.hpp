@@ -0,0 +1,511 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, and Stanford University
+   All rights reserved.
+ 
+   This file is part of Clique and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef CLIQ_SYMBOLIC_GEOMETRICNESTEDDISSECTION_HPP
+#define CLIQ_SYMBOLIC_GEOMETRICNESTEDDISSECTION_HPP
+
+namespace cliq {
+
+#ifdef HAVE_PARMETIS
+// The leaves are ordered with minimum degree, as in NestedDissection, so this
+// requires (Par)METIS as well.
+//
+// The coordinates of the local sources are stored contiguously, so that the
+// d'th coordinate of local source s is coords[d+s*dim]
+void GeometricNestedDissection
+( const DistGraph& graph, 
+        int dim,
+  const std::vector<double>& coords,
+        DistMap& map,
+        DistSeparatorTree& sepTree, 
+        DistSymmInfo& info,
+        int cutoff=128, 
+        bool storeFactRecvInds=false );
+
+int GeometricBisect
+( const Graph& graph, 
+        int dim,
+  const std::vector<double>& coords,
+        Graph& leftChild, 
+        std::vector<double>& leftCoords,
+        Graph& rightChild, 
+        std::vector<double>& rightCoords,
+        std::vector<int>& perm );
+
+// NOTE: for two or more processes
+int GeometricBisect
+( const DistGraph& graph, 
+        int dim,
+  const std::vector<double>& coords,
+        DistGraph& child, 
+        std::vector<double>& childCoords,
+        DistMap& perm,
+        bool& onLeft );
+
+//----------------------------------------------------------------------------//
+// Implementation begins here                                                 //
+//----------------------------------------------------------------------------//
+
+namespace internal {
+
+// Orders sources by a single coordinate (breaking ties by index)
+struct CoordinateLess
+{
+    const double* coords;
+    int dim, splitDim;
+
+    CoordinateLess( const double* coords_, int dim_, int splitDim_ )
+    : coords(coords_), dim(dim_), splitDim(splitDim_)
+    { }
+
+    bool operator()( int s, int t ) const
+    {
+        const double a = coords[splitDim+s*dim];
+        const double b = coords[splitDim+t*dim];
+        return a < b || (a == b && s < t);
+    }
+};
+
+// Send the coordinates of each source of a bisected graph to the process
+// which owns it within the child graph (the team logic must match that of
+// BuildChildFromPerm)
+inline void
+RedistributeCoordinates
+( int dim, const std::vector<double>& coords, const DistMap& perm,
+  int leftChildSize, int rightChildSize, bool onLeft, 
+  const DistGraph& child, std::vector<double>& childCoords )
+{
+    DEBUG_ONLY(CallStackEntry cse("internal::RedistributeCoordinates"))
+    mpi::Comm comm = perm.Comm();
+    const int commSize = mpi::CommSize( comm );
+    const int numLocalSources = perm.NumLocalSources();
+
+    const int smallTeamSize = commSize/2;
+    const int largeTeamSize = commSize - smallTeamSize;
+    const bool smallOnLeft = ( leftChildSize <= rightChildSize );
+    const int leftTeamSize = ( smallOnLeft ? smallTeamSize : largeTeamSize );
+    const int rightTeamSize = ( smallOnLeft ? largeTeamSize : smallTeamSize );
+    const int leftTeamOff = ( smallOnLeft ? 0 : smallTeamSize );
+    const int rightTeamOff = ( smallOnLeft ? smallTeamSize : 0 );
+    const int leftTeamBlocksize = leftChildSize / leftTeamSize;
+    const int rightTeamBlocksize = rightChildSize / rightTeamSize;
+
+    // Determine the destination of each of our sources
+    std::vector<int> owners( numLocalSources, -1 );
+    std::vector<int> sendSizes( commSize, 0 );
+    for( int s=0; s<numLocalSources; ++s )
+    {
+        const int i = perm.GetLocal(s);
+        if( i < leftChildSize )
+            owners[s] = leftTeamOff + 
+                RowToProcess( i, leftTeamBlocksize, leftTeamSize );
+        else if( i < leftChildSize+rightChildSize )
+            owners[s] = rightTeamOff + 
+                RowToProcess
+                ( i-leftChildSize, rightTeamBlocksize, rightTeamSize );
+        if( owners[s] != -1 )
+            ++sendSizes[owners[s]];
+    }
+    std::vector<int> recvSizes( commSize );
+    mpi::AllToAll( &sendSizes[0], 1, &recvSizes[0], 1, comm );
+    int numSends=0, numRecvs=0;
+    std::vector<int> sendOffs( commSize ), recvOffs( commSize );
+    for( int q=0; q<commSize; ++q )
+    {
+        sendOffs[q] = numSends;
+        recvOffs[q] = numRecvs;
+        numSends += sendSizes[q];
+        numRecvs += recvSizes[q];
+    }
+
+    // Exchange the child indices and then the coordinates
+    std::vector<int> sendInds( numSends );
+    std::vector<double> sendCoords( numSends*dim );
+    std::vector<int> offs = sendOffs;
+    for( int s=0; s<numLocalSources; ++s )
+    {
+        const int q = owners[s];
+        if( q != -1 )
+        {
+            sendInds[offs[q]] = perm.GetLocal(s);
+            for( int d=0; d<dim; ++d )
+                sendCoords[d+offs[q]*dim] = coords[d+s*dim];
+            ++offs[q];
+        }
+    }
+    std::vector<int> recvInds( numRecvs );
+    mpi::AllToAll
+    ( &sendInds[0], &sendSizes[0], &sendOffs[0],
+      &recvInds[0], &recvSizes[0], &recvOffs[0], comm );
+    SwapClear( sendInds );
+    for( int q=0; q<commSize; ++q )
+    {
+        sendSizes[q] *= dim;
+        sendOffs[q] *= dim;
+        recvSizes[q] *= dim;
+        recvOffs[q] *= dim;
+    }
+    std::vector<double> recvCoords( numRecvs*dim );
+    mpi::AllToAll
+    ( &sendCoords[0], &sendSizes[0], &sendOffs[0],
+      &recvCoords[0], &recvSizes[0], &recvOffs[0], comm );
+    SwapClear( sendCoords );
+
+    // Unpack the coordinates into the child's local ordering
+    const int childOff = ( onLeft ? 0 : leftChildSize ) + 
+                         child.FirstLocalSource();
+    childCoords.resize( child.NumLocalSources()*dim );
+    for( int k=0; k<numRecvs; ++k )
+    {
+        const int sLocal = recvInds[k] - childOff;
+        for( int d=0; d<dim; ++d )
+            childCoords[d+sLocal*dim] = recvCoords[d+k*dim];
+    }
+}
+
+// Bisects each subproblem with GeometricBisect and hands each child the 
+// coordinates of its own sources, so that the (shared) nested dissection 
+// recursion never needs to know about the coordinates
+struct GeometricBisector
+{
+    int dim;
+    std::vector<double> coords;
+
+    GeometricBisector()
+    : dim(0)
+    { }
+
+    GeometricBisector( int dim_, const std::vector<double>& coords_ )
+    : dim(dim_), coords(coords_)
+    { }
+
+    int Bisect
+    ( const Graph& graph, Graph& leftChild, Graph& rightChild,
+      std::vector<int>& perm, 
+      GeometricBisector& leftBisector, GeometricBisector& rightBisector ) const
+    {
+        leftBisector.dim = rightBisector.dim = dim;
+        return GeometricBisect
+        ( graph, dim, coords, leftChild, leftBisector.coords, 
+          rightChild, rightBisector.coords, perm );
+    }
+
+    int Bisect
+    ( const DistGraph& graph, DistGraph& child, DistMap& perm, bool& onLeft,
+      GeometricBisector& childBisector ) const
+    {
+        childBisector.dim = dim;
+        return GeometricBisect
+        ( graph, dim, coords, child, childBisector.coords, perm, onLeft );
+    }
+};
+
+} // namespace internal
+
+inline void 
+GeometricNestedDissection
+( const DistGraph& graph, 
+        int dim,
+  const std::vector<double>& coords,
+        DistMap& map,
+        DistSeparatorTree& sepTree, 
+        DistSymmInfo& info,
+        int cutoff, 
+        bool storeFactRecvInds )
+{
+    DEBUG_ONLY(CallStackEntry cse("GeometricNestedDissection"))
+    if( dim < 1 )
+        LogicError("The dimension must be positive");
+    if( (int)coords.size() != dim*graph.NumLocalSources() )
+        LogicError("Expected dim coordinates per local source");
+    DistSymmElimTree eTree;
+    internal::BuildSeparatorTree
+    ( graph, internal::GeometricBisector(dim,coords), sepTree, eTree, 
+      cutoff );
+
+    // Construct the distributed reordering    
+    BuildMap( graph, sepTree, map );
+    DEBUG_ONLY(EnsurePermutation( map ))
+
+    // Run the symbolic analysis
+    SymmetricAnalysis( eTree, info, storeFactRecvInds );
+}
+
+inline int 
+GeometricBisect
+( const Graph& graph, 
+        int dim,
+  const std::vector<double>& coords,
+        Graph& leftChild, 
+        std::vector<double>& leftCoords,
+        Graph& rightChild, 
+        std::vector<double>& rightCoords,
+        std::vector<int>& perm )
+{
+    DEBUG_ONLY(CallStackEntry cse("GeometricBisect"))
+    const int numSources = graph.NumSources();
+    if( numSources == 0 )
+        LogicError("There is no reason to bisect an empty sequential graph");
+
+    // Cut perpendicular to the dimension of largest extent
+    int splitDim = 0;
+    double maxExtent = -1;
+    for( int d=0; d<dim; ++d )
+    {
+        double minCoord=coords[d], maxCoord=coords[d];
+        for( int s=1; s<numSources; ++s )
+        {
+            minCoord = std::min( minCoord, coords[d+s*dim] );
+            maxCoord = std::max( maxCoord, coords[d+s*dim] );
+        }
+        if( maxCoord-minCoord > maxExtent )
+        {
+            splitDim = d;
+            maxExtent = maxCoord-minCoord;
+        }
+    }
+
+    // Send the half of the sources with the smallest coordinates left
+    const int half = numSources/2;
+    std::vector<int> order( numSources );
+    for( int s=0; s<numSources; ++s )
+        order[s] = s;
+    std::nth_element
+    ( order.begin(), order.begin()+half, order.end(), 
+      internal::CoordinateLess( &coords[0], dim, splitDim ) );
+    std::vector<int> parts( numSources, 1 );
+    for( int k=0; k<half; ++k )
+        parts[order[k]] = 0;
+    SwapClear( order );
+
+    // Move the boundary of the side with the smaller boundary into the 
+    // separator
+    const int* offsets = graph.LockedOffsetBuffer();
+    const int* targets = graph.LockedTargetBuffer();
+    std::vector<int> onBoundary( numSources, 0 );
+    int numBoundary[2] = { 0, 0 };
+    for( int s=0; s<numSources; ++s )
+    {
+        for( int e=offsets[s]; e<offsets[s+1]; ++e )
+        {
+            const int target = targets[e];
+            if( target < numSources && parts[target] != parts[s] )
+            {
+                onBoundary[s] = 1;
+                ++numBoundary[parts[s]];
+                break;
+            }
+        }
+    }
+    const int sepPart = ( numBoundary[1] <= numBoundary[0] ? 1 : 0 );
+    int partSizes[3] = { 0, 0, 0 };
+    for( int s=0; s<numSources; ++s )
+    {
+        if( onBoundary[s] && parts[s] == sepPart )
+            parts[s] = 2;
+        ++partSizes[parts[s]];
+    }
+    const int leftChildSize = partSizes[0];
+    const int rightChildSize = partSizes[1];
+    const int sepSize = partSizes[2];
+
+    // Order the left side, then the right side, then the separator
+    int partOffs[3] = { 0, leftChildSize, leftChildSize+rightChildSize };
+    perm.resize( numSources );
+    for( int s=0; s<numSources; ++s )
+        perm[s] = partOffs[parts[s]]++;
+    DEBUG_ONLY(EnsurePermutation( perm ))
+    BuildChildrenFromPerm
+    ( graph, perm, leftChildSize, leftChild, rightChildSize, rightChild );
+
+    // Carry the coordinates over to the children
+    leftCoords.resize( leftChildSize*dim );
+    rightCoords.resize( rightChildSize*dim );
+    for( int s=0; s<numSources; ++s )
+    {
+        const int i = perm[s];
+        if( i < leftChildSize )
+            for( int d=0; d<dim; ++d )
+                leftCoords[d+i*dim] = coords[d+s*dim];
+        else if( i < leftChildSize+rightChildSize )
+            for( int d=0; d<dim; ++d )
+                rightCoords[d+(i-leftChildSize)*dim] = coords[d+s*dim];
+    }
+    return sepSize;
+}
+
+inline int 
+GeometricBisect
+( const DistGraph& graph, 
+        int dim,
+  const std::vector<double>& coords,
+        DistGraph& child, 
+        std::vector<double>& childCoords,
+        DistMap& perm,
+        bool& onLeft )
+{
+    DEBUG_ONLY(CallStackEntry cse("GeometricBisect"))
+    const int numSources = graph.NumSources();
+    const int firstLocalSource = graph.FirstLocalSource();
+    const int numLocalSources = graph.NumLocalSources();
+    mpi::Comm comm = graph.Comm();
+    const int commSize = mpi::CommSize( comm );
+    const int commRank = mpi::CommRank( comm );
+    if( commSize == 1 )
+        LogicError
+        ("This routine assumes at least two processes are used, "
+         "otherwise one child will be lost");
+
+    // Cut perpendicular to the dimension of largest extent
+    const double maxDouble = std::numeric_limits<double>::max();
+    std::vector<double> localMins( dim, maxDouble ), 
+                        localMaxs( dim, -maxDouble ),
+                        mins( dim ), maxs( dim );
+    for( int s=0; s<numLocalSources; ++s )
+    {
+        for( int d=0; d<dim; ++d )
+        {
+            localMins[d] = std::min( localMins[d], coords[d+s*dim] );
+            localMaxs[d] = std::max( localMaxs[d], coords[d+s*dim] );
+        }
+    }
+    mpi::AllReduce( &localMins[0], &mins[0], dim, mpi::MIN, comm );
+    mpi::AllReduce( &localMaxs[0], &maxs[0], dim, mpi::MAX, comm );
+    int splitDim = 0;
+    for( int d=1; d<dim; ++d )
+        if( maxs[d]-mins[d] > maxs[splitDim]-mins[splitDim] )
+            splitDim = d;
+
+    // If all of the points coincide, then fall back to splitting by index
+    std::vector<double> keys( numLocalSources );
+    double lower, upper;
+    if( maxs[splitDim] > mins[splitDim] )
+    {
+        for( int s=0; s<numLocalSources; ++s )
+            keys[s] = coords[splitDim+s*dim];
+        lower = mins[splitDim];
+        upper = maxs[splitDim];
+    }
+    else
+    {
+        for( int s=0; s<numLocalSources; ++s )
+            keys[s] = s + firstLocalSource;
+        lower = 0;
+        upper = numSources;
+    }
+
+    // Search for a cut which sends roughly half of the sources left, using
+    // one reduction per step rather than sorting the keys
+    const int half = numSources/2;
+    double cut = upper;
+    for( int step=0; step<50; ++step )
+    {
+        const double mid = (lower+upper)/2;
+        int numLocalBelow = 0;
+        for( int s=0; s<numLocalSources; ++s )
+            if( keys[s] < mid )
+                ++numLocalBelow;
+        const int numBelow = mpi::AllReduce( numLocalBelow, mpi::SUM, comm );
+        if( numBelow == half )
+        {
+            cut = mid;
+            break;
+        }
+        else if( numBelow < half )
+            lower = mid;
+        else
+            upper = cut = mid;
+    }
+    std::vector<int> parts( numLocalSources );
+    for( int s=0; s<numLocalSources; ++s )
+        parts[s] = ( keys[s] < cut ? 0 : 1 );
+    SwapClear( keys );
+
+    // Find the sides of all of the (non-local) neighbors
+    DistMap partMap( numSources, comm );
+    for( int s=0; s<numLocalSources; ++s )
+        partMap.SetLocal( s, parts[s] );
+    const int* offsets = graph.LockedOffsetBuffer();
+    const int* targets = graph.LockedTargetBuffer();
+    std::vector<int> neighbors, neighborSources;
+    for( int s=0; s<numLocalSources; ++s )
+    {
+        for( int e=offsets[s]; e<offsets[s+1]; ++e )
+        {
+            const int target = targets[e];
+            if( target < numSources && target != s+firstLocalSource )
+            {
+                neighbors.push_back( target );
+                neighborSources.push_back( s );
+            }
+        }
+    }
+    partMap.Translate( neighbors );
+
+    // Move the boundary of the side with the smaller boundary into the 
+    // separator
+    std::vector<int> onBoundary( numLocalSources, 0 );
+    const int numNeighbors = neighbors.size();
+    for( int k=0; k<numNeighbors; ++k )
+        if( neighbors[k] != parts[neighborSources[k]] )
+            onBoundary[neighborSources[k]] = 1;
+    int localNumBoundary[2] = { 0, 0 }, numBoundary[2];
+    for( int s=0; s<numLocalSources; ++s )
+        if( onBoundary[s] )
+            ++localNumBoundary[parts[s]];
+    mpi::AllReduce( localNumBoundary, numBoundary, 2, mpi::SUM, comm );
+    const int sepPart = ( numBoundary[1] <= numBoundary[0] ? 1 : 0 );
+    int localPartSizes[3] = { 0, 0, 0 };
+    for( int s=0; s<numLocalSources; ++s )
+    {
+        if( onBoundary[s] && parts[s] == sepPart )
+            parts[s] = 2;
+        ++localPartSizes[parts[s]];
+    }
+
+    // Order the left side, then the right side, then the separator, with
+    // each process's sources in a contiguous block of each part
+    std::vector<int> partSizes( 3*commSize );
+    mpi::AllGather( localPartSizes, 3, &partSizes[0], 3, comm );
+    int leftChildSize=0, rightChildSize=0, sepSize=0;
+    int partOffs[3] = { 0, 0, 0 };
+    for( int q=0; q<commSize; ++q )
+    {
+        if( q == commRank )
+        {
+            partOffs[0] = leftChildSize;
+            partOffs[1] = rightChildSize;
+            partOffs[2] = sepSize;
+        }
+        leftChildSize += partSizes[3*q+0];
+        rightChildSize += partSizes[3*q+1];
+        sepSize += partSizes[3*q+2];
+    }
+    partOffs[1] += leftChildSize;
+    partOffs[2] += leftChildSize + rightChildSize;
+    perm.SetComm( comm );
+    perm.ResizeTo( numSources );
+    for( int s=0; s<numLocalSources; ++s )
+        perm.SetLocal( s, partOffs[parts[s]]++ );
+    DEBUG_ONLY(EnsurePermutation( perm ))
+
+    BuildChildFromPerm
+    ( graph, perm, leftChildSize, rightChildSize, onLeft, child );
+    internal::RedistributeCoordinates
+    ( dim, coords, perm, leftChildSize, rightChildSize, onLeft, 
+      child, childCoords );
+    return sepSize;
+}
+
+#endif // HAVE_PARMETIS
+
+} // namespace cliq
+
+#endif // ifndef CLIQ_SYMBOLIC_GEOMETRICNESTEDDISSECTION_HPP
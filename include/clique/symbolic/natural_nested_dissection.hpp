@@ -22,7 +22,11 @@ void NaturalNestedDissection
         DistSeparatorTree& sepTree, 
         DistSymmInfo& info,
         int cutoff=128, 
-        bool storeFactRecvInds=false );
+        bool storeFactRecvInds=false,
+        int radius=1,
+        double wx=1,
+        double wy=1,
+        double wz=1 );
 
 int NaturalBisect
 (       int nx, 
@@ -37,7 +41,11 @@ int NaturalBisect
         int& nyRight, 
         int& nzRight,
         Graph& rightChild, 
-        std::vector<int>& perm );
+        std::vector<int>& perm,
+        int radius=1,
+        double wx=1,
+        double wy=1,
+        double wz=1 );
 
 // NOTE: for two or more processes
 int NaturalBisect
@@ -50,7 +58,11 @@ int NaturalBisect
         int& nzChild,
         DistGraph& child, 
         DistMap& perm,
-        bool& onLeft );
+        bool& onLeft,
+        int radius=1,
+        double wx=1,
+        double wy=1,
+        double wz=1 );
 
 //----------------------------------------------------------------------------//
 // Implementation begins here                                                 //
@@ -67,7 +79,11 @@ NaturalNestedDissectionRecursion
         DistSymmElimTree& eTree,
         int parent, 
         int off, 
-        int cutoff=128 )
+        int cutoff=128,
+        int radius=1,
+        double wx=1,
+        double wy=1,
+        double wz=1 )
 {
     DEBUG_ONLY(CallStackEntry cse("NaturalNestedDissectionRecursion"))
     if( graph.NumSources() <= cutoff )
@@ -114,7 +130,8 @@ NaturalNestedDissectionRecursion
             NaturalBisect
             ( nx, ny, nz, graph, 
               nxLeft, nyLeft, nzLeft, leftChild, 
-              nxRight, nyRight, nzRight, rightChild, map );
+              nxRight, nyRight, nzRight, rightChild, map, 
+              radius, wx, wy, wz );
         const int numSources = graph.NumSources();
         std::vector<int> inverseMap( numSources );
         for( int s=0; s<numSources; ++s )
@@ -179,11 +196,11 @@ NaturalNestedDissectionRecursion
         node.children[1] = eTree.localNodes.size();
         NaturalNestedDissectionRecursion
         ( nxRight, nyRight, nzRight, rightChild, rightPerm, sepTree, eTree, 
-          parent, off+leftChildSize, cutoff );
+          parent, off+leftChildSize, cutoff, radius, wx, wy, wz );
         node.children[0] = eTree.localNodes.size();
         NaturalNestedDissectionRecursion
         ( nxLeft, nyLeft, nzLeft, leftChild, leftPerm, sepTree, eTree, 
-          parent, off, cutoff );
+          parent, off, cutoff, radius, wx, wy, wz );
     }
 }
 
@@ -199,7 +216,11 @@ NaturalNestedDissectionRecursion
         int depth, 
         int off, 
         bool onLeft,
-        int cutoff=128 )
+        int cutoff=128,
+        int radius=1,
+        double wx=1,
+        double wy=1,
+        double wz=1 )
 {
     DEBUG_ONLY(CallStackEntry cse("NaturalNestedDissectionRecursion"))
     const int distDepth = sepTree.distSeps.size();
@@ -214,7 +235,7 @@ NaturalNestedDissectionRecursion
         const int sepSize = 
             NaturalBisect
             ( nx, ny, nz, graph, nxChild, nyChild, nzChild, child, 
-              map, childIsOnLeft );
+              map, childIsOnLeft, radius, wx, wy, wz );
         const int numSources = graph.NumSources();
         const int childSize = child.NumSources();
         const int leftChildSize = 
@@ -307,7 +328,7 @@ NaturalNestedDissectionRecursion
         const int newOff = ( childIsOnLeft ? off : off+leftChildSize );
         NaturalNestedDissectionRecursion
         ( nxChild, nyChild, nzChild, child, newPerm, sepTree, eTree, depth+1, 
-          newOff, childIsOnLeft, cutoff );
+          newOff, childIsOnLeft, cutoff, radius, wx, wy, wz );
     }
     else if( graph.NumSources() <= cutoff )
     {
@@ -364,7 +385,8 @@ NaturalNestedDissectionRecursion
             NaturalBisect
             ( nx, ny, nz, seqGraph, 
               nxLeft, nyLeft, nzLeft, leftChild, 
-              nxRight, nyRight, nzRight, rightChild, map );
+              nxRight, nyRight, nzRight, rightChild, map, 
+              radius, wx, wy, wz );
         const int numSources = graph.NumSources();
         std::vector<int> inverseMap( numSources );
         for( int s=0; s<numSources; ++s )
@@ -435,11 +457,11 @@ NaturalNestedDissectionRecursion
         localNode.children[1] = eTree.localNodes.size();
         NaturalNestedDissectionRecursion
         ( nxRight, nyRight, nzRight, rightChild, rightPerm, sepTree, eTree, 
-          parent, off+leftChildSize, cutoff );
+          parent, off+leftChildSize, cutoff, radius, wx, wy, wz );
         localNode.children[0] = eTree.localNodes.size();
         NaturalNestedDissectionRecursion
         ( nxLeft, nyLeft, nzLeft, leftChild, leftPerm, sepTree, eTree, 
-          parent, off, cutoff );
+          parent, off, cutoff, radius, wx, wy, wz );
     }
 }
 
@@ -453,9 +475,17 @@ NaturalNestedDissection
         DistSeparatorTree& sepTree, 
         DistSymmInfo& info,
         int cutoff, 
-        bool storeFactRecvInds )
+        bool storeFactRecvInds,
+        int radius,
+        double wx,
+        double wy,
+        double wz )
 {
     DEBUG_ONLY(CallStackEntry cse("NaturalNestedDissection"))
+    if( radius < 1 )
+        LogicError("The stencil radius must be positive");
+    if( wx <= 0 || wy <= 0 || wz <= 0 )
+        LogicError("The dimension weights must be positive");
     // NOTE: There is a potential memory leak here if these data structures 
     //       are reused. Their destructors should call a member function which
     //       we can simply call here to clear the data
@@ -474,7 +504,8 @@ NaturalNestedDissection
     for( int s=0; s<numLocalSources; ++s )
         perm.SetLocal( s, s+firstLocalSource );
     NaturalNestedDissectionRecursion
-    ( nx, ny, nz, graph, perm, sepTree, eTree, 0, 0, false, cutoff );
+    ( nx, ny, nz, graph, perm, sepTree, eTree, 0, 0, false, cutoff,
+      radius, wx, wy, wz );
 
     ReverseOrder( sepTree, eTree );
 
@@ -486,6 +517,69 @@ NaturalNestedDissection
     SymmetricAnalysis( eTree, info, storeFactRecvInds );
 }
 
+namespace internal {
+
+// Split an nx x ny x nz grid with 'radius' planes perpendicular to the 
+// dimension of largest weighted extent (so that a stencil reaching 'radius' 
+// points in each direction cannot connect the two halves), returning the 
+// split dimension and the dimensions of the two children and the separator
+inline int
+NaturalSplit
+( int nx, int ny, int nz, int radius, double wx, double wy, double wz,
+  int* leftDims, int* rightDims, int* sepDims )
+{
+    DEBUG_ONLY(CallStackEntry cse("internal::NaturalSplit"))
+    const int dims[3] = { nx, ny, nz };
+    const double extents[3] = { wx*nx, wy*ny, wz*nz };
+    int splitDim = 0;
+    for( int d=1; d<3; ++d )
+        if( extents[d] > extents[splitDim] )
+            splitDim = d;
+
+    const int numPlanes = std::min( radius, dims[splitDim] );
+    for( int d=0; d<3; ++d )
+        leftDims[d] = rightDims[d] = sepDims[d] = dims[d];
+    leftDims[splitDim] = (dims[splitDim]-numPlanes)/2;
+    rightDims[splitDim] = dims[splitDim]-numPlanes-leftDims[splitDim];
+    sepDims[splitDim] = numPlanes;
+    return splitDim;
+}
+
+// Return the index of grid point i of an nx x ny x nz grid after it has been 
+// split by NaturalSplit, with the left child ordered first, then the right 
+// child, and then the separator (each in its natural ordering)
+inline int
+NaturalSplitIndex
+( int i, int nx, int ny, int splitDim, 
+  const int* leftDims, const int* rightDims, const int* sepDims )
+{
+    int coords[3] = { i % nx, (i/nx) % ny, i/(nx*ny) };
+    const int* childDims;
+    int off;
+    if( coords[splitDim] < leftDims[splitDim] )
+    {
+        childDims = leftDims;
+        off = 0;
+    }
+    else if( coords[splitDim] >= leftDims[splitDim]+sepDims[splitDim] )
+    {
+        coords[splitDim] -= leftDims[splitDim]+sepDims[splitDim];
+        childDims = rightDims;
+        off = leftDims[0]*leftDims[1]*leftDims[2];
+    }
+    else
+    {
+        coords[splitDim] -= leftDims[splitDim];
+        childDims = sepDims;
+        off = leftDims[0]*leftDims[1]*leftDims[2] + 
+              rightDims[0]*rightDims[1]*rightDims[2];
+    }
+    return off + coords[0] + 
+           coords[1]*childDims[0] + coords[2]*childDims[0]*childDims[1];
+}
+
+} // namespace internal
+
 inline int 
 NaturalBisect
 (       int nx, 
@@ -500,117 +594,36 @@ NaturalBisect
         int& nyRight,
         int& nzRight,
         Graph& rightChild,
-        std::vector<int>& perm )
+        std::vector<int>& perm,
+        int radius,
+        double wx,
+        double wy,
+        double wz )
 {
     DEBUG_ONLY(CallStackEntry cse("NaturalBisect"))
     const int numSources = graph.NumSources();
     if( numSources == 0 )
         LogicError("There is no reason to bisect an empty sequential graph");
 
-    int leftChildSize, rightChildSize, sepSize;
+    int leftDims[3], rightDims[3], sepDims[3];
+    const int splitDim = 
+        internal::NaturalSplit
+        ( nx, ny, nz, radius, wx, wy, wz, leftDims, rightDims, sepDims );
+    nxLeft = leftDims[0];
+    nyLeft = leftDims[1];
+    nzLeft = leftDims[2];
+    nxRight = rightDims[0];
+    nyRight = rightDims[1];
+    nzRight = rightDims[2];
+    const int leftChildSize = nxLeft*nyLeft*nzLeft;
+    const int rightChildSize = nxRight*nyRight*nzRight;
+    const int sepSize = sepDims[0]*sepDims[1]*sepDims[2];
+
     perm.resize( numSources );
-    if( nx >= ny && nx >= nz )
-    {
-        nxLeft = (nx-1)/2;
-        nyLeft = ny;
-        nzLeft = nz;
-        leftChildSize = nxLeft*nyLeft*nzLeft;
-
-        nxRight = nx-1-nxLeft;
-        nyRight = ny;
-        nzRight = nz;
-        rightChildSize = nxRight*nyRight*nzRight;
-
-        sepSize = ny*nz;
-
-        // Fill the left side
-        int off=0;
-        for( int z=0; z<nz; ++z )
-            for( int y=0; y<ny; ++y )
-                for( int x=0; x<nxLeft; ++x )
-                    perm[x+y*nx+z*nx*ny] = off++;
-
-        // Fill the right side
-        off = leftChildSize;
-        for( int z=0; z<nz; ++z )
-            for( int y=0; y<ny; ++y )
-                for( int x=nxLeft+1; x<nx; ++x )
-                    perm[x+y*nx+z*nx*ny] = off++;
-
-        // Fill the separator
-        off=leftChildSize+rightChildSize;
-        for( int z=0; z<nz; ++z )
-            for( int y=0; y<ny; ++y )
-                perm[nxLeft+y*nx+z*nx*ny] = off++;
-    }
-    else if( ny >= nx && ny >= nz )
-    {
-        nxLeft = nx;
-        nyLeft = (ny-1)/2;
-        nzLeft = nz;
-        leftChildSize = nxLeft*nyLeft*nzLeft;
-
-        nxRight = nx;
-        nyRight = ny-1-nyLeft;
-        nzRight = nz;
-        rightChildSize = nxRight*nyRight*nzRight;
-
-        sepSize = nx*nz;
-
-        // Fill the left side
-        int off=0;
-        for( int z=0; z<nz; ++z )
-            for( int y=0; y<nyLeft; ++y )
-                for( int x=0; x<nx; ++x )
-                    perm[x+y*nx+z*nx*ny] = off++;
-
-        // Fill the right side
-        off = leftChildSize;
-        for( int z=0; z<nz; ++z )
-            for( int y=nyLeft+1; y<ny; ++y )
-                for( int x=0; x<nx; ++x )
-                    perm[x+y*nx+z*nx*ny] = off++;
-
-        // Fill the separator
-        off=leftChildSize+rightChildSize;
-        for( int z=0; z<nz; ++z )
-            for( int x=0; x<nx; ++x )
-                perm[x+nyLeft*nx+z*nx*ny] = off++;
-    }
-    else
-    {
-        nxLeft = nx;
-        nyLeft = ny;
-        nzLeft = (nz-1)/2;
-        leftChildSize = nxLeft*nyLeft*nzLeft;
-
-        nxRight = nx;
-        nyRight = ny;
-        nzRight = nz-1-nzLeft;
-        rightChildSize = nxRight*nyRight*nzRight;
-
-        sepSize = nx*ny;
-
-        // Fill the left side
-        int off=0;
-        for( int z=0; z<nzLeft; ++z )
-            for( int y=0; y<ny; ++y )
-                for( int x=0; x<nx; ++x )
-                    perm[x+y*nx+z*nx*ny] = off++;
-
-        // Fill the right side
-        off = leftChildSize;
-        for( int z=nzLeft+1; z<nz; ++z )
-            for( int y=0; y<ny; ++y )
-                for( int x=0; x<nx; ++x )
-                    perm[x+y*nx+z*nx*ny] = off++;
-
-        // Fill the separator
-        off=leftChildSize+rightChildSize;
-        for( int y=0; y<ny; ++y )
-            for( int x=0; x<nx; ++x )
-                perm[x+y*nx+nzLeft*nx*ny] = off++;
-    }
+    for( int i=0; i<numSources; ++i )
+        perm[i] = 
+            internal::NaturalSplitIndex
+            ( i, nx, ny, splitDim, leftDims, rightDims, sepDims );
     DEBUG_ONLY(EnsurePermutation( perm ))
     BuildChildrenFromPerm
     ( graph, perm, leftChildSize, leftChild, rightChildSize, rightChild );
@@ -628,7 +641,11 @@ NaturalBisect
         int& nzChild,
         DistGraph& child, 
         DistMap& perm,
-        bool& onLeft )
+        bool& onLeft,
+        int radius,
+        double wx,
+        double wy,
+        double wz )
 {
     DEBUG_ONLY(CallStackEntry cse("NaturalBisect"))
     const int numSources = graph.NumSources();
@@ -642,162 +659,36 @@ NaturalBisect
          "otherwise one child will be lost");
 
     int leftChildSize, rightChildSize, sepSize;
-    int nxLeft, nyLeft, nzLeft, nxRight, nyRight, nzRight;
+    int leftDims[3] = { nx, ny, nz }, rightDims[3] = { nx, ny, nz };
     perm.SetComm( comm );
     perm.ResizeTo( numSources );
     if( nx != 0 && ny != 0 && nz != 0 )
     {
-        if( nx >= ny && nx >= nz )
-        {
-            nxLeft = (nx-1)/2;
-            nyLeft = ny;
-            nzLeft = nz;
-            leftChildSize = nxLeft*nyLeft*nzLeft;
-
-            nxRight = nx-1-nxLeft;
-            nyRight = ny;
-            nzRight = nz;
-            rightChildSize = nxRight*nyRight*nzRight;
-
-            sepSize = ny*nz;
-
-            const int rightOff=leftChildSize, 
-                      sepOff=leftChildSize+rightChildSize;
-            for( int iLocal=0; iLocal<numLocalSources; ++iLocal )
-            {
-                const int i = iLocal + firstLocalSource;
-                const int x = i % nx;
-                const int y = (i/nx) % ny;
-                const int z = i/(nx*ny);
-                if( x < nxLeft )
-                {
-                    const int xLeft = x;
-                    const int leftInd = xLeft + y*nxLeft + z*nxLeft*ny;
-                    perm.SetLocal( iLocal, leftInd );
-                }
-                else if( x > nxLeft )
-                {
-                    const int xRight = x-(nxLeft+1);
-                    const int rightInd = xRight + y*nxRight + z*nxRight*ny;
-                    perm.SetLocal( iLocal, rightOff+rightInd );
-                }
-                else
-                {
-                    const int sepInd = y + z*ny;
-                    perm.SetLocal( iLocal, sepOff+sepInd );
-                }
-            }
-        }
-        else if( ny >= nx && ny >= nz )
-        {
-            nxLeft = nx;
-            nyLeft = (ny-1)/2;
-            nzLeft = nz;
-            leftChildSize = nxLeft*nyLeft*nzLeft;
-
-            nxRight = nx;
-            nyRight = ny-1-nyLeft;
-            nzRight = nz;
-            rightChildSize = nxRight*nyRight*nzRight;
-
-            sepSize = nx*nz;
-
-            const int rightOff=leftChildSize, 
-                      sepOff=leftChildSize+rightChildSize;
-            for( int iLocal=0; iLocal<numLocalSources; ++iLocal )
-            {
-                const int i = iLocal + firstLocalSource;
-                const int x = i % nx;
-                const int y = (i/nx) % ny;
-                const int z = i/(nx*ny);
-                if( y < nyLeft )
-                {
-                    const int yLeft = y;
-                    const int leftInd = x + yLeft*nx + z*nx*nyLeft;
-                    perm.SetLocal( iLocal, leftInd );
-                }
-                else if( y > nyLeft )
-                {
-                    const int yRight = y - (nyLeft+1);
-                    const int rightInd = x + yRight*nx + z*nx*nyRight;
-                    perm.SetLocal( iLocal, rightOff+rightInd );
-                }
-                else
-                {
-                    const int sepInd = x + z*nx;
-                    perm.SetLocal( iLocal, sepOff+sepInd );
-                }
-            }
-        }
-        else
-        {
-            nxLeft = nx;
-            nyLeft = ny;
-            nzLeft = (nz-1)/2;
-            leftChildSize = nxLeft*nyLeft*nzLeft;
-
-            nxRight = nx;
-            nyRight = ny;
-            nzRight = nz-1-nzLeft;
-            rightChildSize = nxRight*nyRight*nzRight;
-
-            sepSize = nx*ny;
-
-            const int rightOff=leftChildSize, 
-                      sepOff=leftChildSize+rightChildSize;
-            for( int iLocal=0; iLocal<numLocalSources; ++iLocal )
-            {
-                const int i = iLocal + firstLocalSource;
-                const int x = i % nx;
-                const int y = (i/nx) % ny;
-                const int z = i/(nx*ny);
-                if( z < nzLeft )
-                {
-                    const int zLeft = z;
-                    const int leftInd = x + y*nx + zLeft*nx*ny;
-                    perm.SetLocal( iLocal, leftInd );
-                }
-                else if( z > nzLeft )
-                {
-                    const int zRight = z - (nzLeft+1);
-                    const int rightInd = x + y*nx + zRight*nx*ny;
-                    perm.SetLocal( iLocal, rightOff+rightInd );
-                }
-                else
-                {
-                    const int sepInd = x + y*nx;
-                    perm.SetLocal( iLocal, sepOff+sepInd );
-                }
-            }
-        }
+        int sepDims[3];
+        const int splitDim = 
+            internal::NaturalSplit
+            ( nx, ny, nz, radius, wx, wy, wz, leftDims, rightDims, sepDims );
+        leftChildSize = leftDims[0]*leftDims[1]*leftDims[2];
+        rightChildSize = rightDims[0]*rightDims[1]*rightDims[2];
+        sepSize = sepDims[0]*sepDims[1]*sepDims[2];
+        for( int iLocal=0; iLocal<numLocalSources; ++iLocal )
+            perm.SetLocal
+            ( iLocal, 
+              internal::NaturalSplitIndex
+              ( iLocal+firstLocalSource, nx, ny, splitDim, 
+                leftDims, rightDims, sepDims ) );
     }
     else
-    {
         leftChildSize = rightChildSize = sepSize = 0;
-        nxLeft = nx;
-        nyLeft = ny;
-        nzLeft = nz;
-        nxRight = nx;
-        nyRight = ny;
-        nzRight = nz;
-    }
     DEBUG_ONLY(EnsurePermutation( perm ))
 
     BuildChildFromPerm
     ( graph, perm, leftChildSize, rightChildSize, onLeft, child );
 
-    if( onLeft )
-    {
-        nxChild = nxLeft;
-        nyChild = nyLeft;
-        nzChild = nzLeft;
-    }
-    else
-    {
-        nxChild = nxRight;
-        nyChild = nyRight;
-        nzChild = nzRight;
-    }
+    const int* childDims = ( onLeft ? leftDims : rightDims );
+    nxChild = childDims[0];
+    nyChild = childDims[1];
+    nzChild = childDims[2];
     return sepSize;
 }
 
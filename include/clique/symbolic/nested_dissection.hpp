@@ -13,12 +13,24 @@
 
 #ifdef HAVE_PARMETIS
 # include "parmetis.h"
+// The local subproblems are only bisected concurrently in release builds (the
+// debugging call stack is not thread-safe) and when the bundled ParMETIS uses
+// the (locally patched) thread-local GKlib random number generator, as the 
+// concurrent calls to CliqBisect would otherwise share the generator's state
+# if defined(HAVE_OPENMP) && defined(RELEASE) && \
+     defined(HAVE_THREAD_LOCAL_GKRAND)
+#  define CLIQ_CONCURRENT_LOCAL_ND
+#  include <omp.h>
+# endif
 
 extern "C" {
 
 void CliqBisect
 ( idx_t* nvtxs, idx_t* xAdj, idx_t* adjacency, idx_t* nseps, real_t* imbalance,
-  idx_t* perm, idx_t* sizes );
+  idx_t* seed, idx_t* perm, idx_t* sizes );
+
+void CliqMinDegree
+( idx_t* nvtxs, idx_t* xAdj, idx_t* adjacency, idx_t* order );
 
 void CliqParallelBisect
 ( idx_t* vtxDist, idx_t* xAdj, idx_t* adjacency, 
@@ -42,6 +54,38 @@ void NestedDissection
         int cutoff=128, 
         bool storeFactRecvInds=false );
 
+// Nested dissection of the quotient graph of a matrix whose nonzeros are 
+// dense blockDim x blockDim blocks. The resulting reordering, separator tree,
+// and symbolic factorization are expanded to the scalar unknowns. Note that
+// the cutoff is in terms of blocks.
+void BlockNestedDissection
+( const DistGraph& quotientGraph, 
+        int blockDim,
+        DistMap& map,
+        DistSeparatorTree& sepTree, 
+        DistSymmInfo& info,
+        bool sequential=true,
+        int numDistSeps=1, 
+        int numSeqSeps=1, 
+        int cutoff=128, 
+        bool storeFactRecvInds=false );
+
+// Nested dissection after merging each run of consecutive vertices (owned by
+// a single process) whose adjacency, including themselves, is identical. The
+// compressed graph is ordered, and the resulting reordering, separator tree,
+// and symbolic factorization are expanded to the original vertices. Note that
+// the cutoff is in terms of compressed vertices.
+void CompressedNestedDissection
+( const DistGraph& graph, 
+        DistMap& map,
+        DistSeparatorTree& sepTree, 
+        DistSymmInfo& info,
+        bool sequential=true,
+        int numDistSeps=1, 
+        int numSeqSeps=1, 
+        int cutoff=128, 
+        bool storeFactRecvInds=false );
+
 int Bisect
 ( const Graph& graph, 
         Graph& leftChild, 
@@ -64,6 +108,15 @@ int DistributedDepth( mpi::Comm comm );
 void EnsurePermutation( const std::vector<int>& map );
 void EnsurePermutation( const DistMap& map );
 void ReverseOrder( DistSeparatorTree& sepTree, DistSymmElimTree& eTree );
+void ExpandBlockOrdering
+( int blockDim, DistSeparatorTree& sepTree, DistSymmElimTree& eTree );
+void CompressGraph
+( const DistGraph& graph, DistGraph& quotientGraph, 
+  DistMap& firstMembers, DistMap& groupSizes );
+void ExpandCompressedOrdering
+( const DistMap& firstMembers, const DistMap& groupSizes, 
+  const DistMap& quotientMap, int numSources,
+  DistSeparatorTree& sepTree, DistSymmElimTree& eTree );
 
 void BuildChildrenFromPerm
 ( const Graph& graph, const std::vector<int>& perm, 
@@ -111,59 +164,443 @@ DistributedDepth( mpi::Comm comm )
 }
 
 #ifdef HAVE_PARMETIS
+namespace internal {
+
+// Append the (not yet seen) targets of the given source which lie outside of
+// the graph's sources, using 'marks' in place of a set. The marker array is
+// grown as needed and must be entirely zero before each sequence of calls.
 inline void
-NestedDissectionRecursion
-( const Graph& graph, 
+MarkAncestors
+( const Graph& graph, int source, 
+  std::vector<int>& marks, std::vector<int>& ancestors )
+{
+    const int numSources = graph.NumSources();
+    const int* offsets = graph.LockedOffsetBuffer();
+    const int* targets = graph.LockedTargetBuffer();
+    for( int e=offsets[source]; e<offsets[source+1]; ++e )
+    {
+        const int target = targets[e];
+        if( target >= numSources )
+        {
+            const int k = target - numSources;
+            if( k >= (int)marks.size() )
+                marks.resize( k+1, 0 );
+            if( !marks[k] )
+            {
+                marks[k] = 1;
+                ancestors.push_back( target );
+            }
+        }
+    }
+}
+
+// Reset the marks set by MarkAncestors and convert the ancestors into a
+// sorted lower structure
+inline void
+FinishAncestors
+( const Graph& graph, int off, 
+  std::vector<int>& marks, std::vector<int>& ancestors )
+{
+    const int numSources = graph.NumSources();
+    const int numAncestors = ancestors.size();
+    for( int k=0; k<numAncestors; ++k )
+    {
+        marks[ancestors[k]-numSources] = 0;
+        ancestors[k] += off;
+    }
+    std::sort( ancestors.begin(), ancestors.end() );
+}
+
+// Append a subtree of the local separator and elimination trees, whose parent
+// and child indices are relative to its own root (which has a parent of -1),
+// to the end of the given trees
+inline void
+AppendLocalSubtree
+( int parent,
+  const std::vector<SepOrLeaf*>& subSepsAndLeaves,
+  const std::vector<SymmNode*>& subNodes,
+        std::vector<SepOrLeaf*>& sepsAndLeaves,
+        std::vector<SymmNode*>& nodes )
+{
+    DEBUG_ONLY(CallStackEntry cse("internal::AppendLocalSubtree"))
+    const int shift = nodes.size();
+    const int numSubNodes = subNodes.size();
+    for( int k=0; k<numSubNodes; ++k )
+    {
+        SepOrLeaf* sepOrLeaf = subSepsAndLeaves[k];
+        SymmNode* node = subNodes[k];
+        if( node->parent == -1 )
+        {
+            sepOrLeaf->parent = parent;
+            node->parent = parent;
+        }
+        else
+        {
+            sepOrLeaf->parent += shift;
+            node->parent += shift;
+        }
+        const int numChildren = node->children.size();
+        for( int c=0; c<numChildren; ++c )
+            node->children[c] += shift;
+        sepsAndLeaves.push_back( sepOrLeaf );
+        nodes.push_back( node );
+    }
+}
+
+// Append the vertices of the subtree of the elimination tree rooted at 
+// 'root' in postorder
+inline void
+AppendPostorder
+( int root, const std::vector<int>& childOffs, 
+  const std::vector<int>& childList, std::vector<int>& order )
+{
+    std::vector<std::pair<int,int> > stack;
+    stack.push_back( std::make_pair(root,childOffs[root]) );
+    while( !stack.empty() )
+    {
+        const int k = stack.back().first;
+        const int c = stack.back().second;
+        if( c < childOffs[k+1] )
+        {
+            ++stack.back().second;
+            stack.push_back
+            ( std::make_pair(childList[c],childOffs[childList[c]]) );
+        }
+        else
+        {
+            order.push_back( k );
+            stack.pop_back();
+        }
+    }
+}
+
+// The elimination tree (in the minimum-degree ordering) of a leaf, along 
+// with the final positions of the vertices which have been placed so far
+struct LeafElimTree
+{
+    int off;
+    std::vector<int> inverseOrder; // minimum-degree position -> vertex
+    std::vector<int> childOffs, childList, subtreeSizes;
+    std::vector<int> finalPos; // vertex -> position in the leaf (or -1)
+};
+
+// Turn a chain of the leaf's elimination tree (listed from the top down) 
+// along with the children of its bottom (or a set of roots) into a node whose
+// subtree occupies [subOff,subOff+subSize) of the leaf. Each child subtree 
+// which is large enough becomes a child of the node (ordered by decreasing
+// size), and the small ones are amalgamated into the node itself.
+inline void
+BuildLeafSubtree
+( const Graph& graph,
   const std::vector<int>& perm,
-        DistSeparatorTree& sepTree, 
-        DistSymmElimTree& eTree,
-        int parent, 
-        int off, 
-        int numSeps=5,
-        int cutoff=128 )
+  LeafElimTree& leafTree,
+  const std::vector<int>& chain,
+        std::vector<int> kids,
+        int subOff,
+        int subSize,
+        std::vector<int>& marks,
+        std::vector<SepOrLeaf*>& sepsAndLeaves,
+        std::vector<SymmNode*>& nodes )
 {
-    DEBUG_ONLY(CallStackEntry cse("NestedDissectionRecursion"))
-    if( graph.NumSources() <= cutoff )
+    // Subtrees this small are not worth splitting up
+    const int minSplitSize = 16;
+    const int* offsets = graph.LockedOffsetBuffer();
+    const int* targets = graph.LockedTargetBuffer();
+    const int numSources = graph.NumSources();
+    const std::vector<int>& sizes = leafTree.subtreeSizes;
+
+    // Order the children by decreasing subtree size and split off the large
+    // ones (keeping at least one vertex in a node without a chain)
+    const int numKids = kids.size();
+    for( int c=1; c<numKids; ++c )
+        for( int d=c; d>0 && sizes[kids[d]] > sizes[kids[d-1]]; --d )
+            std::swap( kids[d], kids[d-1] );
+    int numSplit = 0;
+    if( subSize > minSplitSize )
+        while( numSplit < numKids && sizes[kids[numSplit]] > minSplitSize )
+            ++numSplit;
+    if( chain.empty() && numSplit == numKids && numSplit > 0 )
+        --numSplit;
+
+    // Gather the vertices of this node, with any amalgamated subtrees first
+    std::vector<int> nodeOrder;
+    for( int c=numSplit; c<numKids; ++c )
+        AppendPostorder
+        ( kids[c], leafTree.childOffs, leafTree.childList, nodeOrder );
+    for( int j=chain.size()-1; j>=0; --j )
+        nodeOrder.push_back( chain[j] );
+    const int nodeSize = nodeOrder.size();
+    const int nodeOff = subOff + (subSize-nodeSize);
+    for( int i=0; i<nodeSize; ++i )
+        leafTree.finalPos[leafTree.inverseOrder[nodeOrder[i]]] = nodeOff+i;
+
+    SepOrLeaf* sepOrLeaf = new SepOrLeaf;
+    sepOrLeaf->parent = -1;
+    sepOrLeaf->off = leafTree.off + nodeOff;
+    sepOrLeaf->inds.resize( nodeSize );
+    SymmNode* node = new SymmNode;
+    node->size = nodeSize;
+    node->off = sepOrLeaf->off;
+    node->parent = -1;
+
+    // Every connection to a later vertex is to one which was already placed
+    // (an ancestor in the elimination tree)
+    std::vector<int>& lowerStruct = node->lowerStruct;
+    for( int i=0; i<nodeSize; ++i )
     {
-        // Fill in this node of the local separator tree
-        const int numSources = graph.NumSources();
-        sepTree.localSepsAndLeaves.push_back( new SepOrLeaf );
-        SepOrLeaf& leaf = *sepTree.localSepsAndLeaves.back();
-        leaf.parent = parent;
-        leaf.off = off;
-        leaf.inds = perm;
+        const int source = leafTree.inverseOrder[nodeOrder[i]];
+        sepOrLeaf->inds[i] = perm[source];
+        for( int e=offsets[source]; e<offsets[source+1]; ++e )
+        {
+            const int target = targets[e];
+            if( target < numSources && 
+                leafTree.finalPos[target] < nodeOff+nodeSize )
+                continue;
+            if( target >= (int)marks.size() )
+                marks.resize( target+1, 0 );
+            if( !marks[target] )
+            {
+                marks[target] = 1;
+                lowerStruct.push_back( target );
+            }
+        }
+    }
+    const int numAncestors = lowerStruct.size();
+    for( int k=0; k<numAncestors; ++k )
+    {
+        const int target = lowerStruct[k];
+        marks[target] = 0;
+        lowerStruct[k] = leafTree.off + 
+            ( target < numSources ? leafTree.finalPos[target] : target );
+    }
+    std::sort( lowerStruct.begin(), lowerStruct.end() );
+    sepsAndLeaves.push_back( sepOrLeaf );
+    nodes.push_back( node );
+    if( numSplit == 0 )
+        return;
 
-        // Fill in this node of the local elimination tree
-        eTree.localNodes.push_back( new SymmNode );
-        SymmNode& node = *eTree.localNodes.back();
-        node.size = numSources;
-        node.off = off;
-        node.parent = parent;
-        SwapClear( node.children );
-        std::set<int> connectedAncestors;
-        for( int s=0; s<node.size; ++s )
+    // Recurse on the children from last to first, so that the subtree is 
+    // stored in the same preorder as the rest of the local tree
+    node->children.resize( numSplit );
+    std::vector<int> childSubOffs( numSplit );
+    for( int c=0, childSubOff=subOff; c<numSplit; ++c )
+    {
+        childSubOffs[c] = childSubOff;
+        childSubOff += sizes[kids[c]];
+    }
+    for( int c=numSplit-1; c>=0; --c )
+    {
+        std::vector<int> childChain( 1, kids[c] );
+        int k = kids[c];
+        while( leafTree.childOffs[k+1]-leafTree.childOffs[k] == 1 )
         {
-            const int numConnections = graph.NumConnections( s );
-            const int edgeOff = graph.EdgeOffset( s );
-            for( int t=0; t<numConnections; ++t )
+            k = leafTree.childList[leafTree.childOffs[k]];
+            childChain.push_back( k );
+        }
+        std::vector<int> grandKids
+        ( leafTree.childList.begin()+leafTree.childOffs[k],
+          leafTree.childList.begin()+leafTree.childOffs[k+1] );
+        std::vector<SepOrLeaf*> childSepsAndLeaves;
+        std::vector<SymmNode*> childNodes;
+        BuildLeafSubtree
+        ( graph, perm, leafTree, childChain, grandKids, 
+          childSubOffs[c], sizes[kids[c]], marks, 
+          childSepsAndLeaves, childNodes );
+        node->children[c] = nodes.size();
+        AppendLocalSubtree
+        ( 0, childSepsAndLeaves, childNodes, sepsAndLeaves, nodes );
+    }
+}
+
+// Order a leaf of the nested dissection with multiple minimum degree and
+// split it into a subtree of supernodes (stored in preorder, relative to 
+// the subtree root) rather than a single dense front
+inline void
+MinDegreeLeaf
+( const Graph& graph, 
+  const std::vector<int>& perm,
+        int off,
+        std::vector<int>& marks,
+        std::vector<SepOrLeaf*>& sepsAndLeaves,
+        std::vector<SymmNode*>& nodes )
+{
+    DEBUG_ONLY(CallStackEntry cse("internal::MinDegreeLeaf"))
+    // METIS assumes that there are no self-connections or connections 
+    // outside the sources, so we must manually remove them from our graph
+    const int numSources = graph.NumSources();
+    const int* offsets = graph.LockedOffsetBuffer();
+    const int* targets = graph.LockedTargetBuffer();
+    std::vector<idx_t> xAdj( numSources+1 ), adjacency;
+    adjacency.reserve( offsets[numSources] );
+    for( int s=0; s<numSources; ++s )
+    {
+        xAdj[s] = adjacency.size();
+        for( int e=offsets[s]; e<offsets[s+1]; ++e )
+            if( s != targets[e] && targets[e] < numSources )
+                adjacency.push_back( targets[e] );
+    }
+    xAdj[numSources] = adjacency.size();
+    std::vector<idx_t> order( numSources );
+    idx_t nvtxs = numSources;
+    CliqMinDegree( &nvtxs, &xAdj[0], &adjacency[0], &order[0] );
+    SwapClear( xAdj );
+    SwapClear( adjacency );
+
+    LeafElimTree leafTree;
+    leafTree.off = off;
+    leafTree.inverseOrder.resize( numSources );
+    for( int s=0; s<numSources; ++s )
+        leafTree.inverseOrder[order[s]] = s;
+
+    // Form the elimination tree of the reordered leaf using path compression
+    std::vector<int> parents( numSources, -1 ), ancestors( numSources, -1 );
+    for( int k=0; k<numSources; ++k )
+    {
+        const int source = leafTree.inverseOrder[k];
+        for( int e=offsets[source]; e<offsets[source+1]; ++e )
+        {
+            const int target = targets[e];
+            if( target >= numSources || order[target] >= k )
+                continue;
+            int j = order[target];
+            while( ancestors[j] != -1 && ancestors[j] != k )
             {
-                const int target = graph.Target( edgeOff+t );
-                if( target >= numSources )
-                    connectedAncestors.insert( off+target );
+                const int next = ancestors[j];
+                ancestors[j] = k;
+                j = next;
+            }
+            if( ancestors[j] == -1 )
+            {
+                ancestors[j] = k;
+                parents[j] = k;
             }
         }
-        node.lowerStruct.resize( connectedAncestors.size() );
-        std::copy
-        ( connectedAncestors.begin(), connectedAncestors.end(), 
-          node.lowerStruct.begin() );
+    }
+    SwapClear( ancestors );
+
+    // Store the children of each node contiguously and find the roots
+    std::vector<int> roots;
+    leafTree.childOffs.assign( numSources+1, 0 );
+    leafTree.subtreeSizes.assign( numSources, 1 );
+    for( int k=0; k<numSources; ++k )
+    {
+        if( parents[k] == -1 )
+            roots.push_back( k );
+        else
+        {
+            ++leafTree.childOffs[parents[k]+1];
+            leafTree.subtreeSizes[parents[k]] += leafTree.subtreeSizes[k];
+        }
+    }
+    for( int k=0; k<numSources; ++k )
+        leafTree.childOffs[k+1] += leafTree.childOffs[k];
+    leafTree.childList.resize( leafTree.childOffs[numSources] );
+    std::vector<int> childCounts( numSources, 0 );
+    for( int k=0; k<numSources; ++k )
+    {
+        const int parent = parents[k];
+        if( parent != -1 )
+            leafTree.childList[leafTree.childOffs[parent]+
+                               childCounts[parent]++] = k;
+    }
+    SwapClear( parents );
+    SwapClear( childCounts );
+    leafTree.finalPos.assign( numSources, -1 );
+
+    std::vector<int> chain;
+    if( roots.size() == 1 )
+    {
+        int k = roots[0];
+        chain.push_back( k );
+        while( leafTree.childOffs[k+1]-leafTree.childOffs[k] == 1 )
+        {
+            k = leafTree.childList[leafTree.childOffs[k]];
+            chain.push_back( k );
+        }
+        roots.assign
+        ( leafTree.childList.begin()+leafTree.childOffs[k],
+          leafTree.childList.begin()+leafTree.childOffs[k+1] );
+    }
+    BuildLeafSubtree
+    ( graph, perm, leafTree, chain, roots, 0, numSources, marks, 
+      sepsAndLeaves, nodes );
+}
+
+// The default bisector, which calls (Par)METIS. A bisector is consulted for
+// each subproblem of the recursion and fills in the bisectors of its children
+// (geometric bisectors, for instance, hand each child its own coordinates).
+struct MetisBisector
+{
+    bool sequential;
+    int numDistSeps, numSeqSeps;
+
+    MetisBisector()
+    : sequential(true), numDistSeps(1), numSeqSeps(1)
+    { }
+
+    MetisBisector( bool sequential_, int numDistSeps_, int numSeqSeps_ )
+    : sequential(sequential_), numDistSeps(numDistSeps_), 
+      numSeqSeps(numSeqSeps_)
+    { }
+
+    int Bisect
+    ( const Graph& graph, Graph& leftChild, Graph& rightChild,
+      std::vector<int>& perm, 
+      MetisBisector& leftBisector, MetisBisector& rightBisector ) const
+    {
+        leftBisector = rightBisector = *this;
+        return cliq::Bisect( graph, leftChild, rightChild, perm, numSeqSeps );
+    }
+
+    int Bisect
+    ( const DistGraph& graph, DistGraph& child, DistMap& perm, bool& onLeft,
+      MetisBisector& childBisector ) const
+    {
+        childBisector = *this;
+        return cliq::Bisect
+        ( graph, child, perm, onLeft, sequential, numDistSeps, numSeqSeps );
+    }
+};
+
+// Recursively bisect a sequential graph, storing the resulting subtree in
+// preorder (each node, then its right subtree, then its left subtree) so that
+// ReverseOrder yields a postorder with left children first. The right 
+// subproblem is handed to another thread when OpenMP is available, and the 
+// two subtrees are spliced together in a fixed order so that the result does 
+// not depend upon the scheduling.
+template<typename Bisector>
+inline void
+LocalNestedDissectionRecursion
+( const Graph& graph, 
+  const std::vector<int>& perm,
+  const Bisector& bisector,
+        std::vector<SepOrLeaf*>& sepsAndLeaves,
+        std::vector<SymmNode*>& nodes,
+        std::vector<std::vector<int> >& markers,
+        int off, 
+        int cutoff )
+{
+    DEBUG_ONLY(CallStackEntry cse("internal::LocalNestedDissectionRecursion"))
+    // Each thread reuses its own marker array throughout the recursion
+#ifdef CLIQ_CONCURRENT_LOCAL_ND
+    std::vector<int>& marks = markers[omp_get_thread_num()];
+#else
+    std::vector<int>& marks = markers[0];
+#endif
+    if( graph.NumSources() <= cutoff )
+    {
+        // Order the leaf with minimum degree and split it into supernodes
+        MinDegreeLeaf( graph, perm, off, marks, sepsAndLeaves, nodes );
     }
     else
     {
         // Partition the graph and construct the inverse map
         Graph leftChild, rightChild;
+        Bisector leftBisector, rightBisector;
         std::vector<int> map;
         const int sepSize = 
-            Bisect( graph, leftChild, rightChild, map, numSeps );
+            bisector.Bisect
+            ( graph, leftChild, rightChild, map, leftBisector, rightBisector );
         const int numSources = graph.NumSources();
         std::vector<int> inverseMap( numSources );
         for( int s=0; s<numSources; ++s )
@@ -171,45 +608,31 @@ NestedDissectionRecursion
 
         // Mostly compute this node of the local separator tree
         // (we will finish computing the separator indices soon)
-        sepTree.localSepsAndLeaves.push_back( new SepOrLeaf );
-        SepOrLeaf& sep = *sepTree.localSepsAndLeaves.back();
-        sep.parent = parent;
-        sep.off = off + (numSources-sepSize);
-        sep.inds.resize( sepSize );
+        SepOrLeaf* sep = new SepOrLeaf;
+        sep->parent = -1;
+        sep->off = off + (numSources-sepSize);
+        sep->inds.resize( sepSize );
         for( int s=0; s<sepSize; ++s )
         {
             const int mappedSource = s + (numSources-sepSize);
-            sep.inds[s] = inverseMap[mappedSource];
+            sep->inds[s] = inverseMap[mappedSource];
         }
+        sepsAndLeaves.push_back( sep );
     
         // Fill in this node in the local elimination tree
-        eTree.localNodes.push_back( new SymmNode );
-        SymmNode& node = *eTree.localNodes.back();
-        node.size = sepSize;
-        node.off = sep.off;
-        node.parent = parent;
-        node.children.resize( 2 );
-        std::set<int> connectedAncestors;
+        SymmNode* node = new SymmNode;
+        node->size = sepSize;
+        node->off = sep->off;
+        node->parent = -1;
+        node->children.resize( 2 );
         for( int s=0; s<sepSize; ++s )
-        {
-            const int source = sep.inds[s];
-            const int numConnections = graph.NumConnections( source );
-            const int edgeOff = graph.EdgeOffset( source );
-            for( int t=0; t<numConnections; ++t )
-            {
-                const int target = graph.Target( edgeOff+t );
-                if( target >= numSources )
-                    connectedAncestors.insert( off+target );
-            }
-        }
-        node.lowerStruct.resize( connectedAncestors.size() );
-        std::copy
-        ( connectedAncestors.begin(), connectedAncestors.end(), 
-          node.lowerStruct.begin() );
+            MarkAncestors( graph, sep->inds[s], marks, node->lowerStruct );
+        FinishAncestors( graph, off, marks, node->lowerStruct );
+        nodes.push_back( node );
 
         // Finish computing the separator indices
         for( int s=0; s<sepSize; ++s )
-            sep.inds[s] = perm[sep.inds[s]];
+            sep->inds[s] = perm[sep->inds[s]];
 
         // Construct the inverse maps from the child indices to the original
         // degrees of freedom
@@ -222,47 +645,92 @@ NestedDissectionRecursion
         for( int s=0; s<rightChildSize; ++s )
             rightPerm[s] = perm[inverseMap[s+leftChildSize]];
 
-        // Update right then left so that, once we later reverse the order 
+        // The two subproblems are independent, so only spawn a task if the
+        // right child will itself be bisected
+        std::vector<SepOrLeaf*> rightSepsAndLeaves, leftSepsAndLeaves;
+        std::vector<SymmNode*> rightNodes, leftNodes;
+#ifdef CLIQ_CONCURRENT_LOCAL_ND
+        #pragma omp task default(shared) if( rightChildSize > cutoff )
+#endif
+        LocalNestedDissectionRecursion
+        ( rightChild, rightPerm, rightBisector, rightSepsAndLeaves, rightNodes,
+          markers, off+leftChildSize, cutoff );
+        LocalNestedDissectionRecursion
+        ( leftChild, leftPerm, leftBisector, leftSepsAndLeaves, leftNodes, 
+          markers, off, cutoff );
+#ifdef CLIQ_CONCURRENT_LOCAL_ND
+        #pragma omp taskwait
+#endif
+
+        // Append right then left so that, once we later reverse the order 
         // of the nodes, the left node will be ordered first
-        const int parent = eTree.localNodes.size()-1;
-        node.children[1] = eTree.localNodes.size();
-        NestedDissectionRecursion
-        ( rightChild, rightPerm, sepTree, eTree, parent, off+leftChildSize,
-          numSeps, cutoff );
-        node.children[0] = eTree.localNodes.size();
-        NestedDissectionRecursion
-        ( leftChild, leftPerm, sepTree, eTree, parent, off, 
-          numSeps, cutoff );
+        node->children[1] = nodes.size();
+        AppendLocalSubtree
+        ( 0, rightSepsAndLeaves, rightNodes, sepsAndLeaves, nodes );
+        node->children[0] = nodes.size();
+        AppendLocalSubtree
+        ( 0, leftSepsAndLeaves, leftNodes, sepsAndLeaves, nodes );
+    }
+}
+
+template<typename Bisector>
+inline void
+NestedDissectionRecursion
+( const Graph& graph, 
+  const std::vector<int>& perm,
+  const Bisector& bisector,
+        DistSeparatorTree& sepTree, 
+        DistSymmElimTree& eTree,
+        int parent, 
+        int off, 
+        int cutoff )
+{
+    DEBUG_ONLY(CallStackEntry cse("internal::NestedDissectionRecursion"))
+    std::vector<SepOrLeaf*> sepsAndLeaves;
+    std::vector<SymmNode*> nodes;
+#ifdef CLIQ_CONCURRENT_LOCAL_ND
+    std::vector<std::vector<int> > markers( omp_get_max_threads() );
+    #pragma omp parallel
+    {
+        #pragma omp single
+        LocalNestedDissectionRecursion
+        ( graph, perm, bisector, sepsAndLeaves, nodes, markers, off, cutoff );
     }
+#else
+    std::vector<std::vector<int> > markers( 1 );
+    LocalNestedDissectionRecursion
+    ( graph, perm, bisector, sepsAndLeaves, nodes, markers, off, cutoff );
+#endif
+    AppendLocalSubtree
+    ( parent, sepsAndLeaves, nodes, 
+      sepTree.localSepsAndLeaves, eTree.localNodes );
 }
 
+template<typename Bisector>
 inline void
 NestedDissectionRecursion
 ( const DistGraph& graph, 
   const DistMap& perm,
+  const Bisector& bisector,
         DistSeparatorTree& sepTree, 
         DistSymmElimTree& eTree,
         int depth, 
         int off, 
         bool onLeft,
-        bool sequential=true,
-        int numDistSeps=1, 
-        int numSeqSeps=1,
-        int cutoff=128 )
+        int cutoff )
 {
-    DEBUG_ONLY(CallStackEntry cse("NestedDissectionRecursion"))
+    DEBUG_ONLY(CallStackEntry cse("internal::NestedDissectionRecursion"))
     const int distDepth = sepTree.distSeps.size();
     mpi::Comm comm = graph.Comm();
     if( distDepth - depth > 0 )
     {
         // Partition the graph and construct the inverse map
         DistGraph child;
+        Bisector childBisector;
         bool childIsOnLeft;
         DistMap map;
         const int sepSize = 
-            Bisect
-            ( graph, child, map, childIsOnLeft, 
-              sequential, numDistSeps, numSeqSeps );
+            bisector.Bisect( graph, child, map, childIsOnLeft, childBisector );
         const int numSources = graph.NumSources();
         const int childSize = child.NumSources();
         const int leftChildSize = 
@@ -354,8 +822,8 @@ NestedDissectionRecursion
         // Recurse
         const int newOff = ( childIsOnLeft ? off : off+leftChildSize );
         NestedDissectionRecursion
-        ( child, newPerm, sepTree, eTree, depth+1, newOff, 
-          childIsOnLeft, sequential, numDistSeps, numSeqSeps, cutoff );
+        ( child, newPerm, childBisector, sepTree, eTree, depth+1, newOff, 
+          childIsOnLeft, cutoff );
     }
     else if( graph.NumSources() <= cutoff )
     {
@@ -381,34 +849,28 @@ NestedDissectionRecursion
         distNode.off = localNode.off = off;
         localNode.parent = -1;
         SwapClear( localNode.children );
-        std::set<int> connectedAncestors;
+        std::vector<int> marks;
+        std::vector<int>& lowerStruct = localNode.lowerStruct;
+        SwapClear( lowerStruct );
         for( int s=0; s<numSources; ++s )
-        {
-            const int numConnections = seqGraph.NumConnections( s );
-            const int edgeOff = seqGraph.EdgeOffset( s );
-            for( int t=0; t<numConnections; ++t )
-            {
-                const int target = seqGraph.Target( edgeOff+t );
-                if( target >= numSources )
-                    connectedAncestors.insert( off+target );
-            }
-        }
-        localNode.lowerStruct.resize( connectedAncestors.size() );
-        std::copy
-        ( connectedAncestors.begin(), connectedAncestors.end(), 
-          localNode.lowerStruct.begin() );    
+            MarkAncestors( seqGraph, s, marks, lowerStruct );
+        FinishAncestors( seqGraph, off, marks, lowerStruct );
         distNode.lowerStruct = localNode.lowerStruct;
     }
     else
     {
-        // Convert to a sequential graph
+        // Convert to a sequential graph (our process owns all of it, so the
+        // bisector applies as is)
         Graph seqGraph( graph );
 
         // Partition the graph and construct the inverse map
         Graph leftChild, rightChild;
+        Bisector leftBisector, rightBisector;
         std::vector<int> map;
         const int sepSize = 
-            Bisect( seqGraph, leftChild, rightChild, map, numSeqSeps );
+            bisector.Bisect
+            ( seqGraph, leftChild, rightChild, map, 
+              leftBisector, rightBisector );
         const int numSources = graph.NumSources();
         std::vector<int> inverseMap( numSources );
         for( int s=0; s<numSources; ++s )
@@ -438,23 +900,12 @@ NestedDissectionRecursion
         distNode.off = localNode.off = sep.off;
         localNode.parent = -1;
         localNode.children.resize( 2 );
-        std::set<int> connectedAncestors;
+        std::vector<int> marks;
+        std::vector<int>& lowerStruct = localNode.lowerStruct;
+        SwapClear( lowerStruct );
         for( int s=0; s<sepSize; ++s )
-        {
-            const int source = sep.inds[s];
-            const int numConnections = seqGraph.NumConnections( source );
-            const int edgeOff = seqGraph.EdgeOffset( source );
-            for( int t=0; t<numConnections; ++t )
-            {
-                const int target = seqGraph.Target( edgeOff+t );
-                if( target >= numSources )
-                    connectedAncestors.insert( off+target );
-            }
-        }
-        localNode.lowerStruct.resize( connectedAncestors.size() );
-        std::copy
-        ( connectedAncestors.begin(), connectedAncestors.end(), 
-          localNode.lowerStruct.begin() );
+            MarkAncestors( seqGraph, sep.inds[s], marks, lowerStruct );
+        FinishAncestors( seqGraph, off, marks, lowerStruct );
         distNode.lowerStruct = localNode.lowerStruct;
 
         // Finish computing the separator indices
@@ -478,32 +929,41 @@ NestedDissectionRecursion
         const int parent=0;
         localNode.children[1] = eTree.localNodes.size();
         NestedDissectionRecursion
-        ( rightChild, rightPerm, sepTree, eTree, parent, off+leftChildSize, 
-          numSeqSeps, cutoff );
+        ( rightChild, rightPerm, rightBisector, sepTree, eTree, parent, 
+          off+leftChildSize, cutoff );
         localNode.children[0] = eTree.localNodes.size();
         NestedDissectionRecursion
-        ( leftChild, leftPerm, sepTree, eTree, parent, off, 
-          numSeqSeps, cutoff );
+        ( leftChild, leftPerm, leftBisector, sepTree, eTree, parent, off, 
+          cutoff );
     }
 }
 
-inline void 
-NestedDissection
+// Form the (reversed) separator and elimination trees of a graph using the 
+// given bisector. This is shared by all of the nested dissection variants, 
+// which differ only in how each subproblem is bisected and in how the result 
+// is expanded afterwards.
+template<typename Bisector>
+inline void
+BuildSeparatorTree
 ( const DistGraph& graph, 
-        DistMap& map,
+  const Bisector& bisector,
         DistSeparatorTree& sepTree, 
-        DistSymmInfo& info,
-        bool sequential,
-        int numDistSeps, 
-        int numSeqSeps, 
-        int cutoff,
-        bool storeFactRecvInds )
+        DistSymmElimTree& eTree,
+        int cutoff )
 {
-    DEBUG_ONLY(CallStackEntry cse("NestedDissection"))
+    DEBUG_ONLY(CallStackEntry cse("internal::BuildSeparatorTree"))
+    if( graph.LowerStorage() )
+    {
+        // Nested dissection requires the full sparsity pattern
+        DistGraph symmGraph;
+        Symmetrize( graph, symmGraph );
+        BuildSeparatorTree( symmGraph, bisector, sepTree, eTree, cutoff );
+        return;
+    }
+
     // NOTE: There is a potential memory leak here if these data structures 
     //       are reused. Their destructors should call a member function which
     //       we can simply call here to clear the data
-    DistSymmElimTree eTree;
     SwapClear( eTree.localNodes );
     SwapClear( sepTree.localSepsAndLeaves );
 
@@ -512,16 +972,157 @@ NestedDissection
     eTree.distNodes.resize( distDepth+1 );
     sepTree.distSeps.resize( distDepth );
 
-    DistMap perm( graph.NumSources(), graph.Comm() );
+    DistMap perm( graph.NumSources(), comm );
     const int firstLocalSource = perm.FirstLocalSource();
     const int numLocalSources = perm.NumLocalSources();
     for( int s=0; s<numLocalSources; ++s )
         perm.SetLocal( s, s+firstLocalSource );
     NestedDissectionRecursion
-    ( graph, perm, sepTree, eTree, 0, 0, false, sequential, 
-      numDistSeps, numSeqSeps, cutoff );
+    ( graph, perm, bisector, sepTree, eTree, 0, 0, false, cutoff );
 
     ReverseOrder( sepTree, eTree );
+}
+
+} // namespace internal
+
+inline void
+NestedDissectionRecursion
+( const Graph& graph, 
+  const std::vector<int>& perm,
+        DistSeparatorTree& sepTree, 
+        DistSymmElimTree& eTree,
+        int parent, 
+        int off, 
+        int numSeps=5,
+        int cutoff=128 )
+{
+    DEBUG_ONLY(CallStackEntry cse("NestedDissectionRecursion"))
+    internal::NestedDissectionRecursion
+    ( graph, perm, internal::MetisBisector(true,1,numSeps), sepTree, eTree,
+      parent, off, cutoff );
+}
+
+inline void
+NestedDissectionRecursion
+( const DistGraph& graph, 
+  const DistMap& perm,
+        DistSeparatorTree& sepTree, 
+        DistSymmElimTree& eTree,
+        int depth, 
+        int off, 
+        bool onLeft,
+        bool sequential=true,
+        int numDistSeps=1, 
+        int numSeqSeps=1,
+        int cutoff=128 )
+{
+    DEBUG_ONLY(CallStackEntry cse("NestedDissectionRecursion"))
+    internal::NestedDissectionRecursion
+    ( graph, perm, 
+      internal::MetisBisector(sequential,numDistSeps,numSeqSeps), 
+      sepTree, eTree, depth, off, onLeft, cutoff );
+}
+
+inline void 
+NestedDissection
+( const DistGraph& graph, 
+        DistMap& map,
+        DistSeparatorTree& sepTree, 
+        DistSymmInfo& info,
+        bool sequential,
+        int numDistSeps, 
+        int numSeqSeps, 
+        int cutoff,
+        bool storeFactRecvInds )
+{
+    DEBUG_ONLY(CallStackEntry cse("NestedDissection"))
+    DistSymmElimTree eTree;
+    internal::BuildSeparatorTree
+    ( graph, internal::MetisBisector(sequential,numDistSeps,numSeqSeps),
+      sepTree, eTree, cutoff );
+
+    // Construct the distributed reordering    
+    BuildMap( graph, sepTree, map );
+    DEBUG_ONLY(EnsurePermutation( map ))
+
+    // Run the symbolic analysis
+    SymmetricAnalysis( eTree, info, storeFactRecvInds );
+}
+
+inline void 
+BlockNestedDissection
+( const DistGraph& quotientGraph, 
+        int blockDim,
+        DistMap& map,
+        DistSeparatorTree& sepTree, 
+        DistSymmInfo& info,
+        bool sequential,
+        int numDistSeps, 
+        int numSeqSeps, 
+        int cutoff,
+        bool storeFactRecvInds )
+{
+    DEBUG_ONLY(CallStackEntry cse("BlockNestedDissection"))
+    if( blockDim < 1 )
+        LogicError("Block dimension must be positive");
+    DistSymmElimTree eTree;
+    internal::BuildSeparatorTree
+    ( quotientGraph, 
+      internal::MetisBisector(sequential,numDistSeps,numSeqSeps),
+      sepTree, eTree, cutoff );
+    ExpandBlockOrdering( blockDim, sepTree, eTree );
+
+    // Construct the distributed reordering of the scalar unknowns (the 
+    // scalar graph is only needed for its size and communicator)
+    DistGraph scalarGraph
+    ( blockDim*quotientGraph.NumSources(), quotientGraph.Comm() );
+    BuildMap( scalarGraph, sepTree, map );
+    DEBUG_ONLY(EnsurePermutation( map ))
+
+    // Run the symbolic analysis
+    SymmetricAnalysis( eTree, info, storeFactRecvInds );
+}
+
+inline void
+CompressedNestedDissection
+( const DistGraph& graph, 
+        DistMap& map,
+        DistSeparatorTree& sepTree, 
+        DistSymmInfo& info,
+        bool sequential,
+        int numDistSeps, 
+        int numSeqSeps, 
+        int cutoff,
+        bool storeFactRecvInds )
+{
+    DEBUG_ONLY(CallStackEntry cse("CompressedNestedDissection"))
+    if( graph.LowerStorage() )
+    {
+        // Vertices can only be compared through their full adjacency lists
+        DistGraph symmGraph;
+        Symmetrize( graph, symmGraph );
+        CompressedNestedDissection
+        ( symmGraph, map, sepTree, info, sequential, numDistSeps, numSeqSeps,
+          cutoff, storeFactRecvInds );
+        return;
+    }
+
+    DistGraph quotientGraph;
+    DistMap firstMembers, groupSizes;
+    CompressGraph( graph, quotientGraph, firstMembers, groupSizes );
+
+    DistSymmElimTree eTree;
+    internal::BuildSeparatorTree
+    ( quotientGraph, 
+      internal::MetisBisector(sequential,numDistSeps,numSeqSeps),
+      sepTree, eTree, cutoff );
+
+    // Expand the ordering of the compressed vertices
+    DistMap quotientMap;
+    BuildMap( quotientGraph, sepTree, quotientMap );
+    ExpandCompressedOrdering
+    ( firstMembers, groupSizes, quotientMap, graph.NumSources(), 
+      sepTree, eTree );
 
     // Construct the distributed reordering    
     BuildMap( graph, sepTree, map );
@@ -540,41 +1141,28 @@ Bisect
     // METIS assumes that there are no self-connections or connections 
     // outside the sources, so we must manually remove them from our graph
     const int numSources = graph.NumSources();
-    const int numEdges = graph.NumEdges();
+    const int* offsets = graph.LockedOffsetBuffer();
+    const int* targets = graph.LockedTargetBuffer();
     int numValidEdges = 0;
-    for( int i=0; i<numEdges; ++i )
-        if( graph.Source(i) != graph.Target(i) && graph.Target(i) < numSources )
-            ++numValidEdges;
+    for( int s=0; s<numSources; ++s )
+        for( int e=offsets[s]; e<offsets[s+1]; ++e )
+            if( s != targets[e] && targets[e] < numSources )
+                ++numValidEdges;
 
     // Fill our connectivity (ignoring self and too-large connections)
     std::vector<idx_t> xAdj( numSources+1 );
     std::vector<idx_t> adjacency( numValidEdges );
     int validCounter=0;
-    int sourceOff=0;
-    int prevSource=-1;
-    for( int edge=0; edge<numEdges; ++edge )
+    for( int s=0; s<numSources; ++s )
     {
-        const int source = graph.Source( edge );
-        const int target = graph.Target( edge );
-        DEBUG_ONLY(
-            if( source < prevSource )
-                RuntimeError("sources were not properly sorted");
-        )
-        while( source != prevSource )
-        {
-            xAdj[sourceOff++] = validCounter;
-            ++prevSource;
-        }
-        if( source != target && target < numSources )
+        xAdj[s] = validCounter;
+        for( int e=offsets[s]; e<offsets[s+1]; ++e )
         {
-            adjacency[validCounter] = target;
-            ++validCounter;
+            const int target = targets[e];
+            if( s != target && target < numSources )
+                adjacency[validCounter++] = target;
         }
     }
-    DEBUG_ONLY(
-        if( sourceOff != numSources )
-            LogicError("Mistake in xAdj computation");
-    )
     xAdj[numSources] = numValidEdges;
 
     // Create space for the result
@@ -584,9 +1172,10 @@ Bisect
     idx_t nvtxs = numSources;
     idx_t nseps = numSeps;
     real_t imbalance = 1.1;
+    idx_t seed = -1;
     std::vector<idx_t> sizes(3);
     CliqBisect
-    ( &nvtxs, &xAdj[0], &adjacency[0], &nseps, &imbalance, &perm[0], 
+    ( &nvtxs, &xAdj[0], &adjacency[0], &nseps, &imbalance, &seed, &perm[0], 
       &sizes[0] );
     DEBUG_ONLY(EnsurePermutation( perm ))
     BuildChildrenFromPerm
@@ -616,44 +1205,35 @@ Bisect
     // ParMETIS assumes that there are no self-connections or connections 
     // outside the sources, so we must manually remove them from our graph
     const int numSources = graph.NumSources();
-    const int numLocalEdges = graph.NumLocalEdges();
-    int numLocalValidEdges = 0;
-    for( int i=0; i<numLocalEdges; ++i )
-        if( graph.Source(i) != graph.Target(i) && graph.Target(i) < numSources )
-            ++numLocalValidEdges;
-
-    // Fill our local connectivity (ignoring self and too-large connections)
     const int blocksize = graph.Blocksize();
     const int numLocalSources = graph.NumLocalSources();
     const int firstLocalSource = graph.FirstLocalSource();
+    const int* offsets = graph.LockedOffsetBuffer();
+    const int* targets = graph.LockedTargetBuffer();
+    int numLocalValidEdges = 0;
+    for( int sLocal=0; sLocal<numLocalSources; ++sLocal )
+    {
+        const int s = firstLocalSource + sLocal;
+        for( int e=offsets[sLocal]; e<offsets[sLocal+1]; ++e )
+            if( s != targets[e] && targets[e] < numSources )
+                ++numLocalValidEdges;
+    }
+
+    // Fill our local connectivity (ignoring self and too-large connections)
     std::vector<idx_t> xAdj( numLocalSources+1 );
     std::vector<idx_t> adjacency( numLocalValidEdges );
     int validCounter=0;
-    int sourceOff=0;
-    int prevSource=firstLocalSource-1;
-    for( int localEdge=0; localEdge<numLocalEdges; ++localEdge )
+    for( int sLocal=0; sLocal<numLocalSources; ++sLocal )
     {
-        const int source = graph.Source( localEdge );
-        const int target = graph.Target( localEdge );
-        DEBUG_ONLY(
-            if( source < prevSource )
-                RuntimeError("sources were not properly sorted");
-        )
-        while( source != prevSource )
-        {
-            xAdj[sourceOff++] = validCounter;
-            ++prevSource;
-        }
-        if( source != target && target < numSources )
+        const int s = firstLocalSource + sLocal;
+        xAdj[sLocal] = validCounter;
+        for( int e=offsets[sLocal]; e<offsets[sLocal+1]; ++e )
         {
-            adjacency[validCounter] = target;
-            ++validCounter;
+            const int target = targets[e];
+            if( s != target && target < numSources )
+                adjacency[validCounter++] = target;
         }
     }
-    DEBUG_ONLY(
-        if( sourceOff != numLocalSources )
-            LogicError("Mistake in xAdj computation");
-    )
     xAdj[numLocalSources] = numLocalValidEdges;
 
     idx_t nparseps = numDistSeps;
@@ -662,98 +1242,119 @@ Bisect
     std::vector<idx_t> sizes(3);
     if( sequential )
     {
-        // Gather the number of local valid edges on the root process
-        std::vector<int> edgeSizes( commSize ), edgeOffs;
+        // Compute the exact source and edge distributions
+        std::vector<int> edgeSizes( commSize ), edgeOffs( commSize ),
+                         sourceSizes( commSize ), sourceOffs( commSize );
         mpi::AllGather( &numLocalValidEdges, 1, &edgeSizes[0], 1, comm );
-        int numEdges;
-        if( commRank == 0 )
+        int numEdges=0;
+        for( int q=0; q<commSize; ++q )
         {
-            edgeOffs.resize( commSize );
-            numEdges=0;
-            for( int q=0; q<commSize; ++q )
-            {
-                edgeOffs[q] = numEdges;
-                numEdges += edgeSizes[q];
-            }
+            edgeOffs[q] = numEdges;
+            numEdges += edgeSizes[q];
+            sourceOffs[q] = q*blocksize;
+            sourceSizes[q] = 
+                ( q<commSize-1 ? blocksize : numSources-q*blocksize );
         }
 
-        // Gather the edges on the root process (with padding)
-        int maxLocalValidEdges=0;
-        for( int q=0; q<commSize; ++q )
-            maxLocalValidEdges = 
-                std::max( maxLocalValidEdges, edgeSizes[q] );
-        adjacency.resize( maxLocalValidEdges );
-        std::vector<int> globalAdj;
-        if( commRank == 0 )
-            globalAdj.resize( maxLocalValidEdges*commSize, 0 );
-        mpi::Gather
-        ( &adjacency[0], maxLocalValidEdges, 
-          &globalAdj[0], maxLocalValidEdges, 0, comm );
-
+        // Gather the graph onto the root without any padding
+        std::vector<idx_t> globalAdj, globalXAdj;
         if( commRank == 0 )
         {
-            // Remove the padding
-            for( int q=1; q<commSize; ++q )
-            {
-                const int edgeOff = q*maxLocalValidEdges;
-                for( int j=0; j<edgeSizes[q]; ++j )
-                    globalAdj[edgeOffs[q]+j] = globalAdj[edgeOff+j];
-            }
             globalAdj.resize( numEdges );
-        }
-
-        // Set up the global xAdj vector
-        std::vector<int> globalXAdj;
-        // Set up the first commSize*blocksize entries
-        if( commRank == 0 )
             globalXAdj.resize( numSources+1 );
-        mpi::Gather( &xAdj[0], blocksize, &globalXAdj[0], blocksize, 0, comm );
-        if( commRank == 0 )
-            for( int q=1; q<commSize; ++q )
-                for( int j=0; j<blocksize; ++j )
-                    globalXAdj[q*blocksize+j] += edgeOffs[q];
-        // Fix the remaining entries
-        const int numRemaining = numSources - commSize*blocksize;
-        if( commRank == commSize-1 )
-            mpi::Send( &xAdj[blocksize], numRemaining, 0, comm );
+        }
+        mpi::Gather
+        ( &adjacency[0], numLocalValidEdges,
+          &globalAdj[0], &edgeSizes[0], &edgeOffs[0], 0, comm );
+        mpi::Gather
+        ( &xAdj[0], numLocalSources,
+          &globalXAdj[0], &sourceSizes[0], &sourceOffs[0], 0, comm );
+        SwapClear( adjacency );
+        SwapClear( xAdj );
         if( commRank == 0 )
         {
-            mpi::Recv
-            ( &globalXAdj[commSize*blocksize], numRemaining, commSize-1, comm );
-            for( int j=0; j<numRemaining; ++j )
-                globalXAdj[commSize*blocksize+j] += edgeOffs[commSize-1];
+            for( int q=1; q<commSize; ++q )
+                for( int j=0; j<sourceSizes[q]; ++j )
+                    globalXAdj[sourceOffs[q]+j] += edgeOffs[q];
             globalXAdj[numSources] = numEdges;
         }
 
+        // Spread the requested separator attempts over a small team of
+        // processes, each of which bisects a copy of the graph with its own
+        // random seed
+        const int numTrials = std::min( commSize, std::max(numSeqSeps,1) );
+        const bool inTeam = ( commRank < numTrials );
+        mpi::Comm teamComm;
+        mpi::CommSplit( comm, inTeam, commRank, teamComm );
         std::vector<int> seqPerm;
-        if( commRank == 0 )
+        int winner = 0;
+        if( inTeam )
         {
+            if( commRank != 0 )
+            {
+                globalAdj.resize( numEdges );
+                globalXAdj.resize( numSources+1 );
+            }
+            if( numTrials > 1 )
+            {
+                mpi::Broadcast( &globalXAdj[0], numSources+1, 0, teamComm );
+                mpi::Broadcast( &globalAdj[0], numEdges, 0, teamComm );
+            }
+
             // Use the custom METIS interface
             idx_t nvtxs = numSources;
+            idx_t ntrialseps = 
+                numSeqSeps/numTrials + 
+                ( commRank < numSeqSeps % numTrials ? 1 : 0 );
+            idx_t seed = ( commRank==0 ? -1 : commRank );
             seqPerm.resize( nvtxs );
             CliqBisect
-            ( &nvtxs, &globalXAdj[0], &globalAdj[0], &nseqseps,
-              &imbalance, &seqPerm[0], &sizes[0] );
+            ( &nvtxs, &globalXAdj[0], &globalAdj[0], &ntrialseps,
+              &imbalance, &seed, &seqPerm[0], &sizes[0] );
+            SwapClear( globalAdj );
+            SwapClear( globalXAdj );
+
+            // Keep the smallest separator (the lowest rank breaks ties)
+            if( numTrials > 1 )
+            {
+                std::vector<idx_t> sepSizes( numTrials );
+                mpi::AllGather( &sizes[2], 1, &sepSizes[0], 1, teamComm );
+                for( int q=1; q<numTrials; ++q )
+                    if( sepSizes[q] < sepSizes[winner] )
+                        winner = q;
+            }
         }
+        mpi::CommFree( teamComm );
+        mpi::Broadcast( &winner, 1, 0, comm );
 
         // Set up space for the distributed permutation
         perm.SetComm( comm );
         perm.ResizeTo( numSources );
 
-        // Distribute the first commSize*blocksize values of the permutation
-        mpi::Scatter
-        ( &seqPerm[0], blocksize, perm.Buffer(), blocksize, 0, comm );
-
-        // Make sure the last process gets the straggling entries
-        if( commRank == 0 )
-            mpi::Send
-            ( &seqPerm[commSize*blocksize], numRemaining, commSize-1, comm );
-        if( commRank == commSize-1 )
-            mpi::Recv
-            ( perm.Buffer()+blocksize, numLocalSources-blocksize, 0, comm );
+        // Send each process its piece of the permutation directly from the
+        // process which computed the best separator
+        if( commRank == winner )
+        {
+            std::vector<mpi::Request> requests( commSize-1 );
+            int rCount=0;
+            for( int q=0; q<commSize; ++q )
+            {
+                if( q == commRank )
+                    elem::MemCopy
+                    ( perm.Buffer(), &seqPerm[sourceOffs[q]], sourceSizes[q] );
+                else
+                    mpi::ISend
+                    ( &seqPerm[sourceOffs[q]], sourceSizes[q], q, comm,
+                      requests[rCount++] );
+            }
+            std::vector<mpi::Status> statuses( commSize-1 );
+            mpi::WaitAll( commSize-1, &requests[0], &statuses[0] );
+        }
+        else
+            mpi::Recv( perm.Buffer(), numLocalSources, winner, comm );
 
-        // Broadcast the sizes information from the root
-        mpi::Broadcast( (byte*)&sizes[0], 3*sizeof(idx_t), 0, comm );
+        // Broadcast the sizes information from the winning process
+        mpi::Broadcast( (byte*)&sizes[0], 3*sizeof(idx_t), winner, comm );
     }
     else
     {
@@ -825,6 +1426,331 @@ EnsurePermutation( const DistMap& map )
     }
 }
 
+inline void
+ExpandBlockIndices( int blockDim, std::vector<int>& inds )
+{
+    const int numInds = inds.size();
+    inds.resize( numInds*blockDim );
+    for( int t=numInds-1; t>=0; --t )
+    {
+        const int blockInd = inds[t];
+        for( int c=blockDim-1; c>=0; --c )
+            inds[t*blockDim+c] = blockInd*blockDim + c;
+    }
+}
+
+// Expand each index of the separator and elimination trees of a quotient
+// graph into the blockDim scalar indices which it represents
+inline void
+ExpandBlockOrdering
+( int blockDim, DistSeparatorTree& sepTree, DistSymmElimTree& eTree )
+{
+    DEBUG_ONLY(CallStackEntry cse("ExpandBlockOrdering"))
+    if( blockDim == 1 )
+        return;
+    const int numLocal = sepTree.localSepsAndLeaves.size();
+    for( int s=0; s<numLocal; ++s )
+    {
+        SepOrLeaf& sepOrLeaf = *sepTree.localSepsAndLeaves[s];
+        sepOrLeaf.off *= blockDim;
+        ExpandBlockIndices( blockDim, sepOrLeaf.inds );
+
+        SymmNode& node = *eTree.localNodes[s];
+        node.size *= blockDim;
+        node.off *= blockDim;
+        ExpandBlockIndices( blockDim, node.lowerStruct );
+    }
+    const int numDistSeps = sepTree.distSeps.size();
+    for( int s=0; s<numDistSeps; ++s )
+    {
+        DistSeparator& sep = sepTree.distSeps[s];
+        sep.off *= blockDim;
+        ExpandBlockIndices( blockDim, sep.inds );
+    }
+    const int numDistNodes = eTree.distNodes.size();
+    for( int s=0; s<numDistNodes; ++s )
+    {
+        DistSymmNode& node = eTree.distNodes[s];
+        node.size *= blockDim;
+        node.off *= blockDim;
+        ExpandBlockIndices( blockDim, node.lowerStruct );
+    }
+}
+
+// Merge each run of consecutive local vertices whose adjacency (including
+// the vertex itself) is identical into a single vertex of a quotient graph
+// with the standard distribution. Each process also learns the first member
+// and the size of the groups which it owns in the quotient graph.
+inline void
+CompressGraph
+( const DistGraph& graph, DistGraph& quotientGraph, 
+  DistMap& firstMembers, DistMap& groupSizes )
+{
+    DEBUG_ONLY(CallStackEntry cse("CompressGraph"))
+    mpi::Comm comm = graph.Comm();
+    const int commSize = mpi::CommSize( comm );
+    const int commRank = mpi::CommRank( comm );
+    const int numSources = graph.NumSources();
+    const int numLocalSources = graph.NumLocalSources();
+    const int firstLocalSource = graph.FirstLocalSource();
+    const int* offsets = graph.LockedOffsetBuffer();
+    const int* targets = graph.LockedTargetBuffer();
+
+    // Find the runs of vertices with identical (closed) adjacency
+    std::vector<int> groupStarts, row, lastRow;
+    for( int sLocal=0; sLocal<numLocalSources; ++sLocal )
+    {
+        const int s = firstLocalSource + sLocal;
+        row.assign( targets+offsets[sLocal], targets+offsets[sLocal+1] );
+        std::vector<int>::iterator it = 
+            std::lower_bound( row.begin(), row.end(), s );
+        if( it == row.end() || *it != s )
+            row.insert( it, s );
+        if( sLocal == 0 || row != lastRow )
+            groupStarts.push_back( sLocal );
+        row.swap( lastRow );
+    }
+    const int numLocalGroups = groupStarts.size();
+    groupStarts.push_back( numLocalSources );
+
+    // Number the groups consecutively by process
+    std::vector<int> groupCounts( commSize );
+    mpi::AllGather( &numLocalGroups, 1, &groupCounts[0], 1, comm );
+    int numGroups=0, firstLocalGroup=0;
+    for( int q=0; q<commSize; ++q )
+    {
+        if( q == commRank )
+            firstLocalGroup = numGroups;
+        numGroups += groupCounts[q];
+    }
+    DistMap groupMap( numSources, comm );
+    for( int g=0; g<numLocalGroups; ++g )
+        for( int sLocal=groupStarts[g]; sLocal<groupStarts[g+1]; ++sLocal )
+            groupMap.SetLocal( sLocal, firstLocalGroup+g );
+
+    // Map the adjacency of the first member of each group to the groups
+    std::vector<int> groupTargets, rowBegs( numLocalGroups ), 
+                     rowEnds( numLocalGroups );
+    for( int g=0; g<numLocalGroups; ++g )
+    {
+        const int sLocal = groupStarts[g];
+        rowBegs[g] = groupTargets.size();
+        groupTargets.insert
+        ( groupTargets.end(), 
+          targets+offsets[sLocal], targets+offsets[sLocal+1] );
+    }
+    groupMap.Translate( groupTargets );
+
+    // Send each group's (compressed) adjacency to the owner of its vertex 
+    // in the quotient graph, preceded by the group index, its first member, 
+    // its size, and the number of targets
+    quotientGraph.SetComm( comm );
+    quotientGraph.ResizeTo( numGroups );
+    const int quotientBlocksize = quotientGraph.Blocksize();
+    std::vector<int> sendSizes( commSize, 0 );
+    for( int g=0; g<numLocalGroups; ++g )
+    {
+        const int group = firstLocalGroup + g;
+        std::vector<int>::iterator rowBeg = groupTargets.begin()+rowBegs[g],
+            rowEnd = ( g+1<numLocalGroups ? groupTargets.begin()+rowBegs[g+1]
+                                          : groupTargets.end() );
+        std::sort( rowBeg, rowEnd );
+        rowEnd = std::unique( rowBeg, rowEnd );
+        rowEnd = std::remove( rowBeg, rowEnd, group );
+        rowEnds[g] = rowEnd - groupTargets.begin();
+        const int q = RowToProcess( group, quotientBlocksize, commSize );
+        sendSizes[q] += 4 + (rowEnds[g]-rowBegs[g]);
+    }
+    std::vector<int> recvSizes( commSize );
+    mpi::AllToAll( &sendSizes[0], 1, &recvSizes[0], 1, comm );
+    int numSends=0, numRecvs=0;
+    std::vector<int> sendOffs( commSize ), recvOffs( commSize );
+    for( int q=0; q<commSize; ++q )
+    {
+        sendOffs[q] = numSends;
+        recvOffs[q] = numRecvs;
+        numSends += sendSizes[q];
+        numRecvs += recvSizes[q];
+    }
+    std::vector<int> sendBuf( numSends );
+    std::vector<int> offs = sendOffs;
+    for( int g=0; g<numLocalGroups; ++g )
+    {
+        const int group = firstLocalGroup + g;
+        const int q = RowToProcess( group, quotientBlocksize, commSize );
+        sendBuf[offs[q]++] = group;
+        sendBuf[offs[q]++] = firstLocalSource + groupStarts[g];
+        sendBuf[offs[q]++] = groupStarts[g+1] - groupStarts[g];
+        sendBuf[offs[q]++] = rowEnds[g] - rowBegs[g];
+        for( int e=rowBegs[g]; e<rowEnds[g]; ++e )
+            sendBuf[offs[q]++] = groupTargets[e];
+    }
+    SwapClear( groupTargets );
+    std::vector<int> recvBuf( numRecvs );
+    mpi::AllToAll
+    ( &sendBuf[0], &sendSizes[0], &sendOffs[0],
+      &recvBuf[0], &recvSizes[0], &recvOffs[0], comm );
+    SwapClear( sendBuf );
+
+    // Assemble the quotient graph and the group information
+    firstMembers.SetComm( comm );
+    firstMembers.ResizeTo( numGroups );
+    groupSizes.SetComm( comm );
+    groupSizes.ResizeTo( numGroups );
+    const int firstLocalQuotientSource = quotientGraph.FirstLocalSource();
+    quotientGraph.StartAssembly();
+    quotientGraph.Reserve( numRecvs );
+    for( int k=0; k<numRecvs; )
+    {
+        const int group = recvBuf[k++];
+        firstMembers.SetLocal( group-firstLocalQuotientSource, recvBuf[k++] );
+        groupSizes.SetLocal( group-firstLocalQuotientSource, recvBuf[k++] );
+        const int numTargets = recvBuf[k++];
+        for( int e=0; e<numTargets; ++e )
+            quotientGraph.Insert( group, recvBuf[k++] );
+    }
+    quotientGraph.StopAssembly();
+}
+
+// Expand the ordering of a quotient graph formed by CompressGraph, where
+// 'quotientMap' maps each group to its position in the compressed ordering,
+// so that each group's members are ordered contiguously
+inline void
+ExpandCompressedOrdering
+( const DistMap& firstMembers, const DistMap& groupSizes, 
+  const DistMap& quotientMap, int numSources,
+  DistSeparatorTree& sepTree, DistSymmElimTree& eTree )
+{
+    DEBUG_ONLY(CallStackEntry cse("ExpandCompressedOrdering"))
+    mpi::Comm comm = quotientMap.Comm();
+    const int commSize = mpi::CommSize( comm );
+    const int commRank = mpi::CommRank( comm );
+    const int numGroups = quotientMap.NumSources();
+
+    // Compute the expanded offset of each position in the compressed ordering
+    DistMap inverseMap;
+    quotientMap.FormInverse( inverseMap );
+    std::vector<int> posSizes = inverseMap.Map();
+    groupSizes.Translate( posSizes );
+    const int numLocalPositions = posSizes.size();
+    int localSize=0;
+    for( int i=0; i<numLocalPositions; ++i )
+        localSize += posSizes[i];
+    std::vector<int> localSizes( commSize );
+    mpi::AllGather( &localSize, 1, &localSizes[0], 1, comm );
+    int expandedOff=0;
+    for( int q=0; q<commRank; ++q )
+        expandedOff += localSizes[q];
+    DistMap expandedOffs( numGroups, comm );
+    for( int i=0; i<numLocalPositions; ++i )
+    {
+        expandedOffs.SetLocal( i, expandedOff );
+        expandedOff += posSizes[i];
+    }
+    SwapClear( posSizes );
+
+    // Queue the positions and groups referenced by our trees
+    const int numLocal = sepTree.localSepsAndLeaves.size();
+    const int numDistSeps = sepTree.distSeps.size();
+    const int numDistNodes = eTree.distNodes.size();
+    std::vector<int> positions, groups;
+    for( int s=0; s<numLocal; ++s )
+    {
+        const SepOrLeaf& sepOrLeaf = *sepTree.localSepsAndLeaves[s];
+        groups.insert
+        ( groups.end(), sepOrLeaf.inds.begin(), sepOrLeaf.inds.end() );
+        const SymmNode& node = *eTree.localNodes[s];
+        positions.push_back( node.off );
+        positions.push_back( node.off+node.size );
+        const int structSize = node.lowerStruct.size();
+        for( int i=0; i<structSize; ++i )
+        {
+            positions.push_back( node.lowerStruct[i] );
+            positions.push_back( node.lowerStruct[i]+1 );
+        }
+    }
+    for( int s=0; s<numDistSeps; ++s )
+    {
+        const DistSeparator& sep = sepTree.distSeps[s];
+        groups.insert( groups.end(), sep.inds.begin(), sep.inds.end() );
+        positions.push_back( sep.off );
+    }
+    for( int s=0; s<numDistNodes; ++s )
+    {
+        const DistSymmNode& node = eTree.distNodes[s];
+        positions.push_back( node.off );
+        positions.push_back( node.off+node.size );
+        const int structSize = node.lowerStruct.size();
+        for( int i=0; i<structSize; ++i )
+        {
+            positions.push_back( node.lowerStruct[i] );
+            positions.push_back( node.lowerStruct[i]+1 );
+        }
+    }
+
+    // Translate them all at once (the end of the ordering is left alone by
+    // Translate, so we must manually map it to the number of sources)
+    const int numPositions = positions.size();
+    std::vector<bool> pastEnd( numPositions );
+    for( int i=0; i<numPositions; ++i )
+        pastEnd[i] = ( positions[i] == numGroups );
+    expandedOffs.Translate( positions );
+    for( int i=0; i<numPositions; ++i )
+        if( pastEnd[i] )
+            positions[i] = numSources;
+    std::vector<int> members( groups ), sizes( groups );
+    firstMembers.Translate( members );
+    groupSizes.Translate( sizes );
+
+    // Expand the trees, in the same order that the queues were filled
+    int posInd=0, groupInd=0;
+    std::vector<int> expanded;
+    for( int s=0; s<numLocal; ++s )
+    {
+        SepOrLeaf& sepOrLeaf = *sepTree.localSepsAndLeaves[s];
+        SymmNode& node = *eTree.localNodes[s];
+        const int numInds = sepOrLeaf.inds.size();
+        expanded.resize( 0 );
+        for( int t=0; t<numInds; ++t, ++groupInd )
+            for( int j=0; j<sizes[groupInd]; ++j )
+                expanded.push_back( members[groupInd]+j );
+        sepOrLeaf.inds = expanded;
+
+        node.off = positions[posInd++];
+        node.size = positions[posInd++] - node.off;
+        sepOrLeaf.off = node.off;
+        const int structSize = node.lowerStruct.size();
+        expanded.resize( 0 );
+        for( int i=0; i<structSize; ++i, posInd+=2 )
+            for( int j=positions[posInd]; j<positions[posInd+1]; ++j )
+                expanded.push_back( j );
+        node.lowerStruct = expanded;
+    }
+    for( int s=0; s<numDistSeps; ++s )
+    {
+        DistSeparator& sep = sepTree.distSeps[s];
+        const int numInds = sep.inds.size();
+        expanded.resize( 0 );
+        for( int t=0; t<numInds; ++t, ++groupInd )
+            for( int j=0; j<sizes[groupInd]; ++j )
+                expanded.push_back( members[groupInd]+j );
+        sep.inds = expanded;
+        sep.off = positions[posInd++];
+    }
+    for( int s=0; s<numDistNodes; ++s )
+    {
+        DistSymmNode& node = eTree.distNodes[s];
+        node.off = positions[posInd++];
+        node.size = positions[posInd++] - node.off;
+        const int structSize = node.lowerStruct.size();
+        expanded.resize( 0 );
+        for( int i=0; i<structSize; ++i, posInd+=2 )
+            for( int j=positions[posInd]; j<positions[posInd+1]; ++j )
+                expanded.push_back( j );
+        node.lowerStruct = expanded;
+    }
+}
+
 inline void
 ReverseOrder( DistSeparatorTree& sepTree, DistSymmElimTree& eTree )
 {
@@ -896,81 +1822,84 @@ ReverseOrder( DistSeparatorTree& sepTree, DistSymmElimTree& eTree )
     }
 }
 
+namespace internal {
+
+// Extract the child whose (permuted) sources are
+// [firstSource,firstSource+childSize) directly into CSR buffers, so that
+// only the (short) target list of each source needs to be sorted
 inline void
-BuildChildrenFromPerm
+ExtractChild
 ( const Graph& graph, const std::vector<int>& perm, 
-  int leftChildSize, Graph& leftChild,
-  int rightChildSize, Graph& rightChild )
+  const std::vector<int>& inversePerm, int numChildSources,
+  int firstSource, int childSize, Graph& child )
 {
-    DEBUG_ONLY(
-        CallStackEntry cse("BuildChildrenFromPerm");
-        const int sepSize = graph.NumSources() - leftChildSize - rightChildSize;
-    )
+    DEBUG_ONLY(CallStackEntry cse("internal::ExtractChild"))
     const int numSources = graph.NumSources();
+    const int* offsets = graph.LockedOffsetBuffer();
+    const int* targets = graph.LockedTargetBuffer();
 
-    // Build the inverse permutation
-    std::vector<int> inversePerm( numSources );
-    for( int i=0; i<numSources; ++i )
-        inversePerm[perm[i]] = i;
-
-    // Get an upper bound on the number of edges in the child graphs
-    int leftChildUpperBound=0, rightChildUpperBound=0;
-    for( int s=0; s<leftChildSize; ++s )
-        leftChildUpperBound += graph.NumConnections( inversePerm[s] );
-    for( int s=0; s<rightChildSize; ++s )
-        rightChildUpperBound += 
-            graph.NumConnections( inversePerm[s+leftChildSize] );
-
-    // Build the left child's graph
-    leftChild.ResizeTo( leftChildSize );
-    leftChild.StartAssembly();
-    leftChild.Reserve( leftChildUpperBound );
-    for( int s=0; s<leftChildSize; ++s )
-    {
-        const int source = s;
-        const int inverseSource = inversePerm[s];
-        const int off = graph.EdgeOffset( inverseSource );
-        const int numConnections = graph.NumConnections( inverseSource );
-        for( int t=0; t<numConnections; ++t )
-        {
-            const int inverseTarget = graph.Target( off+t );
-            const int target = ( inverseTarget < numSources ? 
-                                 perm[inverseTarget] :
-                                 inverseTarget );
-            DEBUG_ONLY(
-                if( target >= leftChildSize && target < (numSources-sepSize) )
-                    LogicError("Invalid bisection, left set touches right set");
-            )
-            leftChild.Insert( source, target );
-        }
+    std::vector<int> childOffsets( childSize+1 );
+    childOffsets[0] = 0;
+    for( int s=0; s<childSize; ++s )
+    {
+        const int inverseSource = inversePerm[s+firstSource];
+        childOffsets[s+1] = childOffsets[s] + 
+            (offsets[inverseSource+1]-offsets[inverseSource]);
     }
-    leftChild.StopAssembly();
 
-    // Build the right child's graph
-    rightChild.ResizeTo( rightChildSize );
-    rightChild.StartAssembly();
-    rightChild.Reserve( rightChildUpperBound );
-    for( int s=0; s<rightChildSize; ++s )
+    int numTargets = childSize;
+    std::vector<int> childTargets( childOffsets[childSize] );
+    for( int s=0; s<childSize; ++s )
     {
-        const int source = s+leftChildSize;
-        const int inverseSource = inversePerm[source];
-        const int off = graph.EdgeOffset( inverseSource );
-        const int numConnections = graph.NumConnections( inverseSource );
-        for( int t=0; t<numConnections; ++t )
+        const int inverseSource = inversePerm[s+firstSource];
+        int childEdge = childOffsets[s];
+        for( int e=offsets[inverseSource]; e<offsets[inverseSource+1]; ++e )
         {
-            const int inverseTarget = graph.Target( off+t );
-            const int target = ( inverseTarget < numSources ?
+            const int inverseTarget = targets[e];
+            const int target = ( inverseTarget < numSources ? 
                                  perm[inverseTarget] :
                                  inverseTarget );
             DEBUG_ONLY(
-                if( target < leftChildSize )
-                    LogicError("Invalid bisection, right set touches left set");
+                if( target < numChildSources && 
+                    (target < firstSource || target >= firstSource+childSize) )
+                    LogicError("Invalid bisection, the children are connected");
             )
-            // The targets that are in parent separators do not need to be
-            rightChild.Insert( source-leftChildSize, target-leftChildSize );
+            childTargets[childEdge++] = target - firstSource;
+            numTargets = std::max( numTargets, target-firstSource+1 );
         }
+        std::sort
+        ( childTargets.begin()+childOffsets[s], 
+          childTargets.begin()+childOffsets[s+1] );
     }
-    rightChild.StopAssembly();
+
+    // The targets in parent separators lie beyond the child's sources
+    child.ResizeTo( childSize, numTargets );
+    child.AdoptCSR( childOffsets, childTargets );
+}
+
+} // namespace internal
+
+inline void
+BuildChildrenFromPerm
+( const Graph& graph, const std::vector<int>& perm, 
+  int leftChildSize, Graph& leftChild,
+  int rightChildSize, Graph& rightChild )
+{
+    DEBUG_ONLY(CallStackEntry cse("BuildChildrenFromPerm"))
+    const int numSources = graph.NumSources();
+
+    // Build the inverse permutation
+    std::vector<int> inversePerm( numSources );
+    for( int i=0; i<numSources; ++i )
+        inversePerm[perm[i]] = i;
+
+    const int numChildSources = leftChildSize + rightChildSize;
+    internal::ExtractChild
+    ( graph, perm, inversePerm, numChildSources, 
+      0, leftChildSize, leftChild );
+    internal::ExtractChild
+    ( graph, perm, inversePerm, numChildSources,
+      leftChildSize, rightChildSize, rightChild );
 }
 
 inline void 
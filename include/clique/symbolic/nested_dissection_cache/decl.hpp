@@ -0,0 +1,91 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, and Stanford University
+   All rights reserved.
+ 
+   This file is part of Clique and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef CLIQ_SYMBOLIC_NESTEDDISSECTIONCACHE_DECL_HPP
+#define CLIQ_SYMBOLIC_NESTEDDISSECTIONCACHE_DECL_HPP
+
+namespace cliq {
+
+// A hash of the sparsity structure of a distributed graph (including its 
+// distribution), which is identical on every process in its communicator
+unsigned long long GraphFingerprint( const DistGraph& graph );
+
+#ifdef HAVE_PARMETIS
+// The results of NestedDissection for one graph structure
+struct NestedDissectionEntry
+{
+    DistMap map;
+    DistSeparatorTree sepTree;
+    DistSymmInfo info;
+};
+
+// Reuses the results of NestedDissection (and the symbolic analysis) for 
+// graphs whose structure, distribution, and ordering parameters match those
+// of a previous call. If a directory is specified, each newly-computed 
+// ordering is also written there (one file per process) so that later runs 
+// on the same number of processes may skip the nested dissection.
+//
+// NOTE: The communicators and process grids within the symbolic analysis 
+//       cannot be stored on disk, so the symbolic analysis is rerun when an
+//       ordering is read from a file. All of the graphs passed to a cache 
+//       must share the same communicator.
+class NestedDissectionCache
+{
+public:
+    NestedDissectionCache( const std::string& directory="" );
+    ~NestedDissectionCache();
+
+    // Collectively return the (possibly cached) nested dissection of a graph.
+    // The returned entry is owned by the cache and remains valid until 
+    // Clear is called or the cache is destroyed.
+    const NestedDissectionEntry& Analyze
+    ( const DistGraph& graph,
+      bool sequential=true, int numDistSeps=1, int numSeqSeps=1, 
+      int cutoff=128, bool storeFactRecvInds=false );
+
+    // Release all of the in-memory entries (files are left untouched)
+    void Clear();
+
+    int NumEntries() const;
+    int NumHits() const;
+    int NumMisses() const;
+    // The number of misses which were satisfied by reading from a file
+    int NumLoads() const;
+
+private:
+    struct Key
+    {
+        unsigned long long fingerprint;
+        int numSources, commSize, numDistSeps, numSeqSeps, cutoff;
+        bool sequential, storeFactRecvInds;
+
+        bool operator<( const Key& other ) const;
+    };
+
+    std::string directory_;
+    std::map<Key,NestedDissectionEntry*> entries_;
+    int numHits_, numMisses_, numLoads_;
+
+    std::string FileName( const Key& key, int commRank ) const;
+    bool Load
+    ( const DistGraph& graph, const Key& key, NestedDissectionEntry& entry );
+    void Store
+    ( const DistGraph& graph, const Key& key, 
+      const NestedDissectionEntry& entry ) const;
+
+    // Disallow copies, as the entries own communicators and grids
+    NestedDissectionCache( const NestedDissectionCache& );
+    const NestedDissectionCache& operator=( const NestedDissectionCache& );
+};
+#endif // HAVE_PARMETIS
+
+} // namespace cliq
+
+#endif // ifndef CLIQ_SYMBOLIC_NESTEDDISSECTIONCACHE_DECL_HPP
@@ -0,0 +1,404 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, and Stanford University
+   All rights reserved.
+ 
+   This file is part of Clique and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef CLIQ_SYMBOLIC_NESTEDDISSECTIONCACHE_IMPL_HPP
+#define CLIQ_SYMBOLIC_NESTEDDISSECTIONCACHE_IMPL_HPP
+
+namespace cliq {
+
+namespace internal {
+
+// Fold a sequence of integers into a 64-bit FNV-1a hash
+inline unsigned long long
+HashInts( const int* buffer, int size, 
+          unsigned long long hash=14695981039346656037ULL )
+{
+    const unsigned long long prime = 1099511628211ULL;
+    for( int k=0; k<size; ++k )
+        hash = (hash ^ static_cast<unsigned>(buffer[k])) * prime;
+    return hash;
+}
+
+inline void
+PushInts( std::vector<int>& buffer, const std::vector<int>& values )
+{
+    buffer.push_back( values.size() );
+    buffer.insert( buffer.end(), values.begin(), values.end() );
+}
+
+inline void
+PopInts( const std::vector<int>& buffer, int& pos, std::vector<int>& values )
+{
+    const int size = buffer[pos++];
+    values.assign( buffer.begin()+pos, buffer.begin()+pos+size );
+    pos += size;
+}
+
+} // namespace internal
+
+inline unsigned long long
+GraphFingerprint( const DistGraph& graph )
+{
+    DEBUG_ONLY(CallStackEntry cse("GraphFingerprint"))
+    mpi::Comm comm = graph.Comm();
+    const int commSize = mpi::CommSize( comm );
+    const int numLocalSources = graph.NumLocalSources();
+    const int numLocalEdges = graph.NumLocalEdges();
+
+    // Hash our portion of the structure (a lower-storage graph is ordered 
+    // through its symmetrization)
+    const int sizes[4] = 
+        { graph.NumSources(), graph.FirstLocalSource(), numLocalSources,
+          graph.LowerStorage() };
+    unsigned long long localHash = internal::HashInts( sizes, 4 );
+    localHash = 
+        internal::HashInts
+        ( graph.LockedOffsetBuffer(), numLocalSources+1, localHash );
+    if( numLocalEdges > 0 )
+        localHash = 
+            internal::HashInts
+            ( graph.LockedTargetBuffer(), numLocalEdges, localHash );
+
+    // Combine the local hashes in rank order
+    const int localHashes[2] = 
+        { static_cast<int>(localHash>>32), 
+          static_cast<int>(localHash&0xffffffffULL) };
+    std::vector<int> hashes( 2*commSize );
+    mpi::AllGather( localHashes, 2, &hashes[0], 2, comm );
+    return internal::HashInts( &hashes[0], 2*commSize );
+}
+
+#ifdef HAVE_PARMETIS
+inline bool
+NestedDissectionCache::Key::operator<( const Key& other ) const
+{
+    if( fingerprint != other.fingerprint )
+        return fingerprint < other.fingerprint;
+    const int a[7] = 
+        { numSources, commSize, numDistSeps, numSeqSeps, cutoff, 
+          sequential, storeFactRecvInds };
+    const int b[7] = 
+        { other.numSources, other.commSize, other.numDistSeps, 
+          other.numSeqSeps, other.cutoff, 
+          other.sequential, other.storeFactRecvInds };
+    return std::lexicographical_compare( a, a+7, b, b+7 );
+}
+
+inline
+NestedDissectionCache::NestedDissectionCache( const std::string& directory )
+: directory_(directory), numHits_(0), numMisses_(0), numLoads_(0)
+{ }
+
+inline
+NestedDissectionCache::~NestedDissectionCache()
+{ Clear(); }
+
+inline void
+NestedDissectionCache::Clear()
+{
+    DEBUG_ONLY(CallStackEntry cse("NestedDissectionCache::Clear"))
+    std::map<Key,NestedDissectionEntry*>::iterator it;
+    for( it=entries_.begin(); it!=entries_.end(); ++it )
+        delete it->second;
+    entries_.clear();
+}
+
+inline int
+NestedDissectionCache::NumEntries() const
+{ return entries_.size(); }
+
+inline int
+NestedDissectionCache::NumHits() const
+{ return numHits_; }
+
+inline int
+NestedDissectionCache::NumMisses() const
+{ return numMisses_; }
+
+inline int
+NestedDissectionCache::NumLoads() const
+{ return numLoads_; }
+
+inline const NestedDissectionEntry&
+NestedDissectionCache::Analyze
+( const DistGraph& graph, 
+  bool sequential, int numDistSeps, int numSeqSeps, 
+  int cutoff, bool storeFactRecvInds )
+{
+    DEBUG_ONLY(CallStackEntry cse("NestedDissectionCache::Analyze"))
+    Key key;
+    key.fingerprint = GraphFingerprint( graph );
+    key.numSources = graph.NumSources();
+    key.commSize = mpi::CommSize( graph.Comm() );
+    key.numDistSeps = numDistSeps;
+    key.numSeqSeps = numSeqSeps;
+    key.cutoff = cutoff;
+    key.sequential = sequential;
+    key.storeFactRecvInds = storeFactRecvInds;
+
+    // Since the fingerprint is the same on every process, so is this branch
+    std::map<Key,NestedDissectionEntry*>::iterator it = entries_.find( key );
+    if( it != entries_.end() )
+    {
+        ++numHits_;
+        return *it->second;
+    }
+
+    ++numMisses_;
+    NestedDissectionEntry* entry = new NestedDissectionEntry;
+    if( Load( graph, key, *entry ) )
+        ++numLoads_;
+    else
+    {
+        NestedDissection
+        ( graph, entry->map, entry->sepTree, entry->info, 
+          sequential, numDistSeps, numSeqSeps, cutoff, storeFactRecvInds );
+        if( directory_ != "" )
+            Store( graph, key, *entry );
+    }
+    entries_[key] = entry;
+    return *entry;
+}
+
+inline std::string
+NestedDissectionCache::FileName( const Key& key, int commRank ) const
+{
+    std::ostringstream fileName;
+    fileName << directory_ << "/nd-" << std::hex << key.fingerprint 
+             << std::dec << "-" << key.sequential << "-" << key.numDistSeps 
+             << "-" << key.numSeqSeps << "-" << key.cutoff << "-" 
+             << key.commSize << "-" << commRank << ".bin";
+    return fileName.str();
+}
+
+// Each file is a sequence of ints: the number of ints which follow, a header
+// describing the ordering, the local portions of the map, separator tree, 
+// and elimination tree, and finally a hash of everything but the last two 
+// ints (so that truncated or corrupted files are ignored)
+inline void
+NestedDissectionCache::Store
+( const DistGraph& graph, const Key& key, 
+  const NestedDissectionEntry& entry ) const
+{
+    DEBUG_ONLY(CallStackEntry cse("NestedDissectionCache::Store"))
+    const int commRank = mpi::CommRank( graph.Comm() );
+    std::vector<int> buffer( 1, 0 );
+    buffer.push_back( static_cast<int>(key.fingerprint>>32) );
+    buffer.push_back( static_cast<int>(key.fingerprint&0xffffffffULL) );
+    buffer.push_back( key.numSources );
+    buffer.push_back( key.commSize );
+    buffer.push_back( commRank );
+
+    // The local portion of the map
+    internal::PushInts( buffer, entry.map.Map() );
+
+    // The separator tree
+    const DistSeparatorTree& sepTree = entry.sepTree;
+    const int numLocalSeps = sepTree.localSepsAndLeaves.size();
+    buffer.push_back( numLocalSeps );
+    for( int s=0; s<numLocalSeps; ++s )
+    {
+        const SepOrLeaf& sepOrLeaf = *sepTree.localSepsAndLeaves[s];
+        buffer.push_back( sepOrLeaf.parent );
+        buffer.push_back( sepOrLeaf.off );
+        internal::PushInts( buffer, sepOrLeaf.inds );
+    }
+    const int numDistSeps = sepTree.distSeps.size();
+    buffer.push_back( numDistSeps );
+    for( int s=0; s<numDistSeps; ++s )
+    {
+        buffer.push_back( sepTree.distSeps[s].off );
+        internal::PushInts( buffer, sepTree.distSeps[s].inds );
+    }
+
+    // The elimination tree (as recorded by the symbolic analysis)
+    const DistSymmInfo& info = entry.info;
+    const int numLocalNodes = info.localNodes.size();
+    buffer.push_back( numLocalNodes );
+    for( int s=0; s<numLocalNodes; ++s )
+    {
+        const SymmNodeInfo& node = info.localNodes[s];
+        buffer.push_back( node.size );
+        buffer.push_back( node.off );
+        buffer.push_back( node.parent );
+        internal::PushInts( buffer, node.children );
+        internal::PushInts( buffer, node.origLowerStruct );
+    }
+    const int numDistNodes = info.distNodes.size();
+    buffer.push_back( numDistNodes );
+    for( int s=0; s<numDistNodes; ++s )
+    {
+        const DistSymmNodeInfo& node = info.distNodes[s];
+        buffer.push_back( node.size );
+        buffer.push_back( node.off );
+        buffer.push_back( node.onLeft );
+        internal::PushInts( buffer, node.origLowerStruct );
+    }
+
+    buffer[0] = buffer.size()+1;
+    const unsigned long long hash = 
+        internal::HashInts( &buffer[0], buffer.size() );
+    buffer.push_back( static_cast<int>(hash>>32) );
+    buffer.push_back( static_cast<int>(hash&0xffffffffULL) );
+
+    const std::string fileName = FileName( key, commRank );
+    std::ofstream file
+    ( fileName.c_str(), std::ios::out|std::ios::binary );
+    if( !file.is_open() )
+    {
+        std::ostringstream msg;
+        msg << "Could not open " << fileName << " for writing";
+        RuntimeError( msg.str() );
+    }
+    file.write
+    ( reinterpret_cast<const char*>(&buffer[0]), buffer.size()*sizeof(int) );
+    file.close();
+}
+
+inline bool
+NestedDissectionCache::Load
+( const DistGraph& graph, const Key& key, NestedDissectionEntry& entry )
+{
+    DEBUG_ONLY(CallStackEntry cse("NestedDissectionCache::Load"))
+    if( directory_ == "" )
+        return false;
+    mpi::Comm comm = graph.Comm();
+    const int commRank = mpi::CommRank( comm );
+
+    // Read and check our file (the leading size must account for exactly 
+    // the remainder of the file before it is used to allocate the buffer)
+    std::vector<int> buffer;
+    const std::string fileName = FileName( key, commRank );
+    std::ifstream file( fileName.c_str(), std::ios::in|std::ios::binary );
+    long long fileSize = -1;
+    if( file.is_open() )
+    {
+        file.seekg( 0, std::ios::end );
+        fileSize = file.tellg();
+        file.seekg( 0, std::ios::beg );
+    }
+    int size;
+    if( file.is_open() && fileSize > 0 &&
+        file.read( reinterpret_cast<char*>(&size), sizeof(int) ) && 
+        size >= 7 && 
+        (size+1LL)*static_cast<long long>(sizeof(int)) == fileSize )
+    {
+        buffer.resize( size+1 );
+        buffer[0] = size;
+        if( !file.read
+            ( reinterpret_cast<char*>(&buffer[1]), size*sizeof(int) ) )
+            SwapClear( buffer );
+    }
+    file.close();
+    int valid = 0;
+    if( buffer.size() != 0 )
+    {
+        const int numInts = buffer.size();
+        const unsigned long long hash = 
+            internal::HashInts( &buffer[0], numInts-2 );
+        valid = 
+            buffer[numInts-2] == static_cast<int>(hash>>32) &&
+            buffer[numInts-1] == static_cast<int>(hash&0xffffffffULL) &&
+            buffer[1] == static_cast<int>(key.fingerprint>>32) &&
+            buffer[2] == static_cast<int>(key.fingerprint&0xffffffffULL) &&
+            buffer[3] == key.numSources && 
+            buffer[4] == key.commSize && 
+            buffer[5] == commRank &&
+            buffer[6] == graph.NumLocalSources();
+    }
+    // Every process must have a valid file in order to skip the ordering
+    if( mpi::AllReduce( valid, mpi::MIN, comm ) == 0 )
+        return false;
+
+    // The local portion of the map
+    int pos = 6;
+    DistMap& map = entry.map;
+    map.SetComm( comm );
+    map.ResizeTo( key.numSources );
+    internal::PopInts( buffer, pos, map.Map() );
+
+    // The separator tree
+    DistSeparatorTree& sepTree = entry.sepTree;
+    const int numLocalSeps = buffer[pos++];
+    sepTree.localSepsAndLeaves.resize( numLocalSeps );
+    for( int s=0; s<numLocalSeps; ++s )
+    {
+        sepTree.localSepsAndLeaves[s] = new SepOrLeaf;
+        SepOrLeaf& sepOrLeaf = *sepTree.localSepsAndLeaves[s];
+        sepOrLeaf.parent = buffer[pos++];
+        sepOrLeaf.off = buffer[pos++];
+        internal::PopInts( buffer, pos, sepOrLeaf.inds );
+    }
+    const int numDistSeps = buffer[pos++];
+    sepTree.distSeps.resize( numDistSeps );
+    for( int s=0; s<numDistSeps; ++s )
+    {
+        sepTree.distSeps[s].off = buffer[pos++];
+        internal::PopInts( buffer, pos, sepTree.distSeps[s].inds );
+    }
+
+    // The elimination tree
+    DistSymmElimTree eTree;
+    const int numLocalNodes = buffer[pos++];
+    eTree.localNodes.resize( numLocalNodes );
+    for( int s=0; s<numLocalNodes; ++s )
+    {
+        eTree.localNodes[s] = new SymmNode;
+        SymmNode& node = *eTree.localNodes[s];
+        node.size = buffer[pos++];
+        node.off = buffer[pos++];
+        node.parent = buffer[pos++];
+        internal::PopInts( buffer, pos, node.children );
+        internal::PopInts( buffer, pos, node.lowerStruct );
+    }
+    const int numDistNodes = buffer[pos++];
+    eTree.distNodes.resize( numDistNodes );
+    for( int s=0; s<numDistNodes; ++s )
+    {
+        DistSymmNode& node = eTree.distNodes[s];
+        node.size = buffer[pos++];
+        node.off = buffer[pos++];
+        node.onLeft = buffer[pos++];
+        internal::PopInts( buffer, pos, node.lowerStruct );
+    }
+    SwapClear( buffer );
+
+    // Recreate the communicators by following the same splits as the 
+    // bisections (the small team is always formed from the first half of 
+    // the processes)
+    const int distDepth = numDistSeps;
+    mpi::Comm teamComm = comm;
+    for( int depth=0; depth<=distDepth; ++depth )
+    {
+        mpi::CommDup( teamComm, eTree.distNodes[distDepth-depth].comm );
+        if( depth < distDepth )
+        {
+            mpi::CommDup( teamComm, sepTree.distSeps[distDepth-1-depth].comm );
+            const int teamSize = mpi::CommSize( teamComm );
+            const int teamRank = mpi::CommRank( teamComm );
+            mpi::Comm childComm;
+            mpi::CommSplit
+            ( teamComm, teamRank < teamSize/2, teamRank, childComm );
+            if( depth > 0 )
+                mpi::CommFree( teamComm );
+            teamComm = childComm;
+        }
+    }
+    if( distDepth > 0 )
+        mpi::CommFree( teamComm );
+
+    SymmetricAnalysis( eTree, entry.info, key.storeFactRecvInds );
+    return true;
+}
+#endif // HAVE_PARMETIS
+
+} // namespace cliq
+
+#endif // ifndef CLIQ_SYMBOLIC_NESTEDDISSECTIONCACHE_IMPL_HPP
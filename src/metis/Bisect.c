@@ -35,7 +35,8 @@ void CliqOrder( ctrl_t *ctrl, graph_t *graph, idx_t *order, idx_t *sizes )
 /* TODO: Better error-handling */
 void CliqBisect
 ( idx_t *nvtxs, idx_t *xadj, idx_t *adjncy,
-  idx_t *numSeps, real_t *imbalance, idx_t *order, idx_t *sizes ) 
+  idx_t *numSeps, real_t *imbalance, idx_t *seed, idx_t *order, 
+  idx_t *sizes ) 
 {
   int sigrval=0;
   idx_t options[METIS_NOPTIONS];
@@ -64,6 +65,9 @@ void CliqBisect
   options[METIS_OPTION_COMPRESS] = 0;
   options[METIS_OPTION_NSEPS] = *numSeps;
   options[METIS_OPTION_UFACTOR] = (int)((*imbalance-1)*1000);
+  /* a negative seed keeps METIS's default random sequence */
+  if( *seed >= 0 )
+    options[METIS_OPTION_SEED] = *seed;
   ctrl = SetupCtrl(METIS_OP_OMETIS, options, 1, 3, NULL, NULL);
   if (!ctrl) {
     gk_siguntrap();
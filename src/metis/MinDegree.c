@@ -0,0 +1,38 @@
+/*
+ * Copyright 1997, Regents of the University of Minnesota
+ */
+#include "metislib.h"
+
+/* Order a graph (without self-connections) via multiple minimum degree, so 
+   that order[i] is the new position of vertex i. The adjacency structure is
+   destroyed. */
+void CliqMinDegree( idx_t *nvtxs, idx_t *xadj, idx_t *adjncy, idx_t *order )
+{
+  idx_t i, n, nofsub;
+  idx_t *perm, *iperm, *head, *qsize, *list, *marker;
+
+  n = *nvtxs;
+  if( n == 0 )
+    return;
+
+  /* Relabel the vertices so that it starts from 1 */
+  for( i=0; i<xadj[n]; i++ )
+    adjncy[i]++;
+  for( i=0; i<n+1; i++ )
+    xadj[i]++;
+
+  perm   = imalloc(n+5, "CliqMinDegree: perm");
+  iperm  = imalloc(n+5, "CliqMinDegree: iperm");
+  head   = imalloc(n+5, "CliqMinDegree: head");
+  qsize  = imalloc(n+5, "CliqMinDegree: qsize");
+  list   = imalloc(n+5, "CliqMinDegree: list");
+  marker = imalloc(n+5, "CliqMinDegree: marker");
+
+  genmmd(n, xadj, adjncy, iperm, perm, 1, head, qsize, list, marker, IDX_MAX, 
+         &nofsub);
+
+  for( i=0; i<n; i++ )
+    order[i] = iperm[i]-1;
+
+  gk_free((void **)&perm, &iperm, &head, &qsize, &list, &marker, LTERM);
+}
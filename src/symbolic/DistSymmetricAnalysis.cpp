@@ -379,8 +379,11 @@ void DistSymmetricAnalysis
     bottomDist.lowerStruct = topLocal.lowerStruct;
     bottomDist.origLowerStruct = topLocal.origLowerStruct;
     bottomDist.origLowerRelInds = topLocal.origLowerRelInds;
-    bottomDist.leftRelInds = topLocal.leftRelInds;
-    bottomDist.rightRelInds = topLocal.rightRelInds;
+    if( topLocal.childRelInds.size() == 2 )
+    {
+        bottomDist.leftRelInds = topLocal.childRelInds[0];
+        bottomDist.rightRelInds = topLocal.childRelInds[1];
+    }
     bottomDist.leftSize = -1; // not needed, could compute though
     bottomDist.rightSize = -1; // not needed, could compute though
 
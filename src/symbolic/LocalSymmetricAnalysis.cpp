@@ -31,33 +31,11 @@ void LocalSymmetricAnalysis( const DistSymmElimTree& eTree, DistSymmInfo& info )
         nodeInfo.origLowerStruct = node.lowerStruct;
 
         const Int numChildren = node.children.size();
-        DEBUG_ONLY(
-            if( numChildren != 0 && numChildren != 2 )
-                LogicError("Tree must be built from bisections");
-        )
-        if( numChildren == 2 )
+        if( numChildren > 0 )
         {
-            const Int left = node.children[0];
-            const Int right = node.children[1];
-            SymmNodeInfo& leftChild = info.localNodes[left];
-            SymmNodeInfo& rightChild = info.localNodes[right];
-            leftChild.onLeft = true;
-            rightChild.onLeft = false;
             DEBUG_ONLY(
-                if( !IsStrictlySorted(leftChild.lowerStruct) )
-                {
-                    if( IsSorted(leftChild.lowerStruct) )
-                        LogicError("Repeat in left lower struct");
-                    else
-                        LogicError("Left lower struct not sorted");
-                }
-                if( !IsStrictlySorted(rightChild.lowerStruct) )
-                {
-                    if( IsSorted(rightChild.lowerStruct) )
-                        LogicError("Repeat in right lower struct");
-                    else
-                        LogicError("Right lower struct not sorted");
-                }
+                if( !IsStrictlySorted(node.children) )
+                    LogicError("Children must be in increasing order");
                 if( !IsStrictlySorted(node.lowerStruct) )
                 {
                     if( IsSorted(node.lowerStruct) )
@@ -68,8 +46,22 @@ void LocalSymmetricAnalysis( const DistSymmElimTree& eTree, DistSymmInfo& info )
             )
 
             // Combine the structures of the children
-            auto childrenStruct = 
-                Union( leftChild.lowerStruct, rightChild.lowerStruct );
+            std::vector<Int> childrenStruct;
+            for( Int c=0; c<numChildren; ++c )
+            {
+                SymmNodeInfo& child = info.localNodes[node.children[c]];
+                child.whichChild = c;
+                DEBUG_ONLY(
+                    if( !IsStrictlySorted(child.lowerStruct) )
+                    {
+                        if( IsSorted(child.lowerStruct) )
+                            LogicError("Repeat in child lower struct");
+                        else
+                            LogicError("Child lower struct not sorted");
+                    }
+                )
+                childrenStruct = Union( childrenStruct, child.lowerStruct );
+            }
 
             // Now add in the original lower structure
             auto partialStruct = Union( node.lowerStruct, childrenStruct );
@@ -85,10 +77,12 @@ void LocalSymmetricAnalysis( const DistSymmElimTree& eTree, DistSymmInfo& info )
                 RelativeIndices( node.lowerStruct, fullStruct );
 
             // Construct the relative indices of the children
-            nodeInfo.leftRelInds = 
-                RelativeIndices( leftChild.lowerStruct, fullStruct );
-            nodeInfo.rightRelInds =
-                RelativeIndices( rightChild.lowerStruct, fullStruct );
+            nodeInfo.childRelInds.resize( numChildren );
+            for( Int c=0; c<numChildren; ++c )
+                nodeInfo.childRelInds[c] = 
+                    RelativeIndices
+                    ( info.localNodes[node.children[c]].lowerStruct, 
+                      fullStruct );
 
             // Form lower struct of this node by removing node indices
             // (which take up the first node.size indices of fullStruct)
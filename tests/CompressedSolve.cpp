@@ -0,0 +1,162 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, and Stanford University
+   All rights reserved.
+ 
+   This file is part of Clique and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "clique.hpp"
+using namespace cliq;
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+
+    try
+    {
+        const int n = Input("--n","size of n x n x n grid",15);
+        const int dof = Input("--dof","unknowns per grid point",3);
+        const int numRhs = Input("--numRhs","number of right-hand sides",5);
+        const bool sequential = Input
+            ("--sequential","sequential partitions?",true);
+        const int numDistSeps = Input
+            ("--numDistSeps",
+             "number of separators to try per distributed partition",1);
+        const int numSeqSeps = Input
+            ("--numSeqSeps",
+             "number of separators to try per sequential partition",1);
+        const int cutoff = Input("--cutoff","cutoff for nested dissection",64);
+        const double tol = Input("--tol","maximum relative residual",1e-8);
+        ProcessInput();
+
+        // Couple every unknown of each grid point of a 7-point stencil to 
+        // every unknown of the neighboring points (and of its own point), so
+        // that the 'dof' unknowns of each point are indistinguishable. The 
+        // matrix is diagonally dominant, and thus positive-definite.
+        const int N = dof*n*n*n;
+        DistSparseMatrix<double> A( N, comm );
+        const int firstLocalRow = A.FirstLocalRow();
+        const int localHeight = A.LocalHeight();
+        if( commRank == 0 )
+        {
+            std::cout << "Filling local portion of matrix...";
+            std::cout.flush();
+        }
+        A.StartAssembly();
+        A.Reserve( 7*dof*localHeight );
+        for( int iLocal=0; iLocal<localHeight; ++iLocal )
+        {
+            const int i = firstLocalRow + iLocal;
+            const int point = i / dof;
+            const int x = point % n;
+            const int y = (point/n) % n;
+            const int z = point/(n*n);
+
+            std::vector<int> points( 1, point );
+            if( x != 0 )
+                points.push_back( point-1 );
+            if( x != n-1 )
+                points.push_back( point+1 );
+            if( y != 0 )
+                points.push_back( point-n );
+            if( y != n-1 )
+                points.push_back( point+n );
+            if( z != 0 )
+                points.push_back( point-n*n );
+            if( z != n-1 )
+                points.push_back( point+n*n );
+            const int numPoints = points.size();
+            for( int k=0; k<numPoints; ++k )
+                for( int c=0; c<dof; ++c )
+                    if( points[k]*dof+c != i )
+                        A.Update( i, points[k]*dof+c, -1. );
+            A.Update( i, i, double(numPoints*dof+1) );
+        }
+        A.StopAssembly();
+        mpi::Barrier( comm );
+        if( commRank == 0 )
+            std::cout << "done" << std::endl;
+
+        // Report how much the graph was compressed
+        const DistGraph& graph = A.LockedDistGraph();
+        {
+            DistGraph quotientGraph;
+            DistMap firstMembers, groupSizes;
+            CompressGraph( graph, quotientGraph, firstMembers, groupSizes );
+            if( commRank == 0 )
+                std::cout << "Compressed " << N << " vertices into " 
+                          << quotientGraph.NumSources() << " groups" 
+                          << std::endl;
+        }
+
+        if( commRank == 0 )
+        {
+            std::cout << "Running compressed nested dissection...";
+            std::cout.flush();
+        }
+        DistSymmInfo info;
+        DistSeparatorTree sepTree;
+        DistMap map, inverseMap;
+        CompressedNestedDissection
+        ( graph, map, sepTree, info, 
+          sequential, numDistSeps, numSeqSeps, cutoff );
+        EnsurePermutation( map );
+        map.FormInverse( inverseMap );
+        mpi::Barrier( comm );
+        if( commRank == 0 )
+            std::cout << "done" << std::endl;
+
+        DistMultiVec<double> X( N, numRhs, comm ), Y( N, numRhs, comm );
+        MakeUniform( X );
+        MakeZeros( Y );
+        Multiply( 1., A, X, 0., Y );
+        std::vector<double> YOrigNorms;
+        Norms( Y, YOrigNorms );
+
+        if( commRank == 0 )
+        {
+            std::cout << "Factoring and solving...";
+            std::cout.flush();
+        }
+        DistSymmFrontTree<double> frontTree( A, map, sepTree, info, false );
+        LDL( info, frontTree, LDL_1D );
+        DistMultiVec<double> XComp( comm );
+        XComp = Y;
+        DistNodalMultiVec<double> XNodal;
+        XNodal.Pull( inverseMap, info, XComp );
+        Solve( info, frontTree, XNodal );
+        XNodal.Push( inverseMap, info, XComp );
+        mpi::Barrier( comm );
+        if( commRank == 0 )
+            std::cout << "done" << std::endl;
+
+        // R := A XComp - Y
+        DistMultiVec<double> R( comm );
+        R = Y;
+        Multiply( 1., A, XComp, -1., R );
+        std::vector<double> residNorms;
+        Norms( R, residNorms );
+        for( int j=0; j<numRhs; ++j )
+        {
+            if( commRank == 0 )
+                std::cout << "Right-hand side " << j << ": relative residual "
+                          << residNorms[j]/YOrigNorms[j] << std::endl;
+            if( residNorms[j] > tol*YOrigNorms[j] )
+            {
+                std::ostringstream msg;
+                msg << "Relative residual of right-hand side " << j << " was "
+                    << residNorms[j]/YOrigNorms[j] << " > " << tol;
+                RuntimeError( msg.str() );
+            }
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
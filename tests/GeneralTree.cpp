@@ -0,0 +1,212 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, and Stanford University
+   All rights reserved.
+ 
+   This file is part of Clique and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "clique.hpp"
+using namespace cliq;
+
+// Factor and solve with a hand-built elimination tree whose nodes have 
+// zero, one, two, three, and four children (nested dissection only produces 
+// such trees within its leaves). Each process works on its own copy of the
+// problem, so this may be run with any number of processes.
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    const int commRank = mpi::CommRank( mpi::COMM_WORLD );
+    mpi::Comm comm = mpi::COMM_SELF;
+
+    try
+    {
+        const int nodeSize = Input("--nodeSize","base size of each node",20);
+        const int numRhs = Input("--numRhs","number of right-hand sides",5);
+        const double tol = Input("--tol","maximum relative residual",1e-10);
+        ProcessInput();
+        if( nodeSize < 2 )
+            LogicError("Nodes must have at least two vertices");
+
+        // The tree is stored in postorder: node 1 has the single child 0, 
+        // node 4 has the children 1, 2, and 3, node 9 has the children 5, 6, 
+        // 7, and 8, and the root, 10, has the children 4 and 9
+        const int numNodes = 11;
+        const int parents[numNodes] = { 1, 4, 4, 4, 10, 9, 9, 9, 9, 10, -1 };
+        std::vector<int> sizes( numNodes ), offs( numNodes );
+        int N = 0;
+        for( int t=0; t<numNodes; ++t )
+        {
+            sizes[t] = nodeSize + (t % 3);
+            offs[t] = N;
+            N += sizes[t];
+        }
+        std::vector<int> owners( N );
+        for( int t=0; t<numNodes; ++t )
+            for( int i=offs[t]; i<offs[t]+sizes[t]; ++i )
+                owners[i] = t;
+
+        // Connect each vertex to the next two vertices of its node, the first
+        // vertex of each node to the first vertex of each of its ancestors,
+        // and the last vertex of each node to the last vertex of its parent.
+        // Every connection outside of a node is thus to an ancestor.
+        std::vector<std::set<int> > adjacency( N );
+        for( int t=0; t<numNodes; ++t )
+        {
+            const int first = offs[t];
+            const int last = offs[t] + sizes[t] - 1;
+            for( int i=first; i<=last; ++i )
+                for( int j=i+1; j<=std::min(i+2,last); ++j )
+                    adjacency[i].insert( j );
+            for( int p=parents[t]; p!=-1; p=parents[p] )
+                adjacency[first].insert( offs[p] );
+            if( parents[t] != -1 )
+                adjacency[last].insert( offs[parents[t]]+sizes[parents[t]]-1 );
+        }
+        for( int i=0; i<N; ++i )
+        {
+            std::set<int>::const_iterator it;
+            for( it=adjacency[i].begin(); it!=adjacency[i].end(); ++it )
+                if( *it > i )
+                    adjacency[*it].insert( i );
+        }
+
+        // Form a diagonally dominant (and thus positive-definite) matrix
+        DistSparseMatrix<double> A( N, comm );
+        A.StartAssembly();
+        for( int i=0; i<N; ++i )
+        {
+            A.Update( i, i, adjacency[i].size()+1. );
+            std::set<int>::const_iterator it;
+            for( it=adjacency[i].begin(); it!=adjacency[i].end(); ++it )
+                A.Update( i, *it, -1. );
+        }
+        A.StopAssembly();
+
+        // Build the separator and elimination trees directly in postorder, 
+        // with each node's original vertices in their natural order
+        DistSeparatorTree sepTree;
+        DistSymmElimTree eTree;
+        for( int t=0; t<numNodes; ++t )
+        {
+            SepOrLeaf* sepOrLeaf = new SepOrLeaf;
+            sepOrLeaf->parent = parents[t];
+            sepOrLeaf->off = offs[t];
+            sepOrLeaf->inds.resize( sizes[t] );
+            for( int s=0; s<sizes[t]; ++s )
+                sepOrLeaf->inds[s] = offs[t] + s;
+            sepTree.localSepsAndLeaves.push_back( sepOrLeaf );
+
+            SymmNode* node = new SymmNode;
+            node->size = sizes[t];
+            node->off = offs[t];
+            node->parent = parents[t];
+            for( int c=0; c<t; ++c )
+                if( parents[c] == t )
+                    node->children.push_back( c );
+            std::set<int> lowerStruct;
+            for( int i=offs[t]; i<offs[t]+sizes[t]; ++i )
+            {
+                std::set<int>::const_iterator it;
+                for( it=adjacency[i].begin(); it!=adjacency[i].end(); ++it )
+                    if( owners[*it] > t )
+                        lowerStruct.insert( *it );
+            }
+            node->lowerStruct.assign( lowerStruct.begin(), lowerStruct.end() );
+            eTree.localNodes.push_back( node );
+        }
+        eTree.distNodes.resize( 1 );
+        DistSymmNode& distRoot = eTree.distNodes[0];
+        const SymmNode& localRoot = *eTree.localNodes.back();
+        distRoot.onLeft = false;
+        mpi::CommDup( comm, distRoot.comm );
+        distRoot.size = localRoot.size;
+        distRoot.off = localRoot.off;
+        distRoot.lowerStruct = localRoot.lowerStruct;
+
+        DistMap map, inverseMap;
+        BuildMap( A.LockedDistGraph(), sepTree, map );
+        EnsurePermutation( map );
+        map.FormInverse( inverseMap );
+        DistSymmInfo info;
+        SymmetricAnalysis( eTree, info );
+        for( int t=0; t<numNodes; ++t )
+        {
+            const SymmNodeInfo& node = info.localNodes[t];
+            const int numChildren = node.children.size();
+            if( (int)node.childRelInds.size() != numChildren )
+                LogicError("Expected relative indices for each child");
+            for( int c=0; c<numChildren; ++c )
+                if( info.localNodes[node.children[c]].whichChild != c )
+                    LogicError("Child does not know its position");
+        }
+
+        DistMultiVec<double> X( N, numRhs, comm ), Y( N, numRhs, comm );
+        MakeUniform( X );
+        MakeZeros( Y );
+        Multiply( 1., A, X, 0., Y );
+        std::vector<double> YOrigNorms;
+        Norms( Y, YOrigNorms );
+
+        // Factor and solve with both 1D and selectively-inverted 2D fronts,
+        // as each uses different local extend-adds and triangular solves
+        for( int trial=0; trial<2; ++trial )
+        {
+            const bool selInv = ( trial == 1 );
+            DistSymmFrontTree<double> frontTree( A, map, sepTree, info, false );
+            DistMultiVec<double> XComp( comm );
+            XComp = Y;
+            if( selInv )
+            {
+                LDL( info, frontTree, LDL_SELINV_2D );
+                DistNodalMatrix<double> XNodal;
+                XNodal.Pull( inverseMap, info, XComp );
+                Solve( info, frontTree, XNodal );
+                XNodal.Push( inverseMap, info, XComp );
+            }
+            else
+            {
+                LDL( info, frontTree, LDL_1D );
+                DistNodalMultiVec<double> XNodal;
+                XNodal.Pull( inverseMap, info, XComp );
+                Solve( info, frontTree, XNodal );
+                XNodal.Push( inverseMap, info, XComp );
+            }
+
+            // R := A XComp - Y
+            DistMultiVec<double> R( comm );
+            R = Y;
+            Multiply( 1., A, XComp, -1., R );
+            std::vector<double> residNorms;
+            Norms( R, residNorms );
+            for( int j=0; j<numRhs; ++j )
+            {
+                if( residNorms[j] > tol*YOrigNorms[j] )
+                {
+                    std::ostringstream msg;
+                    msg << "Relative residual of right-hand side " << j 
+                        << " was " << residNorms[j]/YOrigNorms[j] << " > " 
+                        << tol << " (selInv=" << selInv << ")";
+                    RuntimeError( msg.str() );
+                }
+            }
+            if( commRank == 0 )
+            {
+                double maxRelResid = 0;
+                for( int j=0; j<numRhs; ++j )
+                    maxRelResid = 
+                        std::max( maxRelResid, residNorms[j]/YOrigNorms[j] );
+                std::cout << ( selInv ? "LDL_SELINV_2D" : "LDL_1D" )
+                          << ": max relative residual " << maxRelResid 
+                          << std::endl;
+            }
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
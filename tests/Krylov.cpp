@@ -0,0 +1,132 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, and Stanford University
+   All rights reserved.
+ 
+   This file is part of Clique and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "clique.hpp"
+using namespace cliq;
+
+// Fill the 3D negative Laplacian, shifted by 'shift', using an n x n x n 
+// 7-point stencil in natural ordering
+void
+FillShiftedLaplacian( DistSparseMatrix<double>& A, int n, double shift )
+{
+    const int firstLocalRow = A.FirstLocalRow();
+    const int localHeight = A.LocalHeight();
+    A.StartAssembly();
+    A.Reserve( 7*localHeight );
+    for( int iLocal=0; iLocal<localHeight; ++iLocal )
+    {
+        const int i = firstLocalRow + iLocal;
+        const int x = i % n;
+        const int y = (i/n) % n;
+        const int z = i/(n*n);
+
+        A.Update( i, i, 6.-shift );
+        if( x != 0 )
+            A.Update( i, i-1, -1. );
+        if( x != n-1 )
+            A.Update( i, i+1, -1. );
+        if( y != 0 )
+            A.Update( i, i-n, -1. );
+        if( y != n-1 )
+            A.Update( i, i+n, -1. );
+        if( z != 0 )
+            A.Update( i, i-n*n, -1. );
+        if( z != n-1 )
+            A.Update( i, i+n*n, -1. );
+    }
+    A.StopAssembly();
+}
+
+// Throw if the relative residual of any column of X exceeds the tolerance
+void
+CheckResiduals
+( const DistSparseMatrix<double>& A, const DistMultiVec<double>& B, 
+  const DistMultiVec<double>& X, double tol, const std::string& label, 
+  int numIts )
+{
+    DistMultiVec<double> R;
+    R = B;
+    Multiply( -1., A, X, 1., R );
+    std::vector<double> bNorms, rNorms;
+    Norms( B, bNorms );
+    Norms( R, rNorms );
+    double maxRelResid = 0;
+    for( unsigned j=0; j<rNorms.size(); ++j )
+        maxRelResid = std::max( maxRelResid, rNorms[j]/bNorms[j] );
+    if( mpi::CommRank( A.Comm() ) == 0 )
+        std::cout << label << " took " << numIts << " iterations, max "
+                  << "relative residual: " << maxRelResid << std::endl;
+    if( maxRelResid > tol )
+    {
+        std::ostringstream msg;
+        msg << label << " relative residual was " << maxRelResid 
+            << " > " << tol;
+        RuntimeError( msg.str() );
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const int n = Input("--n","size of n x n x n grid",20);
+        const int numRhs = Input("--numRhs","number of right-hand sides",4);
+        const double precShift = Input
+            ("--precShift","diagonal shift of the SPD preconditioner",1.);
+        const double shift = Input
+            ("--shift","shift which makes the Laplacian indefinite",0.5);
+        const int restart = Input("--restart","GMRES restart length",30);
+        const int maxIts = Input("--maxIts","maximum number of iterations",500);
+        const double relTol = Input
+            ("--relTol","relative tolerance of the Krylov methods",1e-8);
+        const double checkTol = Input
+            ("--checkTol","maximum acceptable relative residual",1e-6);
+        const bool progress = Input("--progress","print progress?",false);
+        ProcessInput();
+
+        // Form the Laplacian, an indefinite shift of it, and a more 
+        // diagonally dominant version whose factorization preconditions CG 
+        // (so that the Krylov methods have work to do)
+        const int N = n*n*n;
+        DistSparseMatrix<double> A( N, comm ), S( N, comm ), P( N, comm );
+        FillShiftedLaplacian( A, n, 0. );
+        FillShiftedLaplacian( S, n, shift );
+        FillShiftedLaplacian( P, n, -precShift );
+        DistSymmSolver<double> M( P );
+
+        DistMultiVec<double> B( N, numRhs, comm ), X( N, numRhs, comm );
+        MakeUniform( B );
+
+        // The SPD Laplacian with CG
+        MakeZeros( X );
+        int numIts = CG( A, M, B, X, relTol, maxIts, progress );
+        CheckResiduals( A, B, X, checkTol, "CG", numIts );
+
+        // The indefinite shifted Laplacian with MINRES and GMRES, using a 
+        // factorization of the unshifted (SPD) Laplacian as the preconditioner
+        // (the MINRES tolerance is in the inv(M) norm, hence the separate 
+        // tolerance for the check)
+        M.Refactor( A );
+        MakeZeros( X );
+        numIts = MINRES( S, M, B, X, relTol, maxIts, progress );
+        CheckResiduals( S, B, X, checkTol, "MINRES", numIts );
+
+        MakeZeros( X );
+        numIts = GMRES( S, M, B, X, restart, relTol, maxIts, progress );
+        CheckResiduals( S, B, X, checkTol, "GMRES", numIts );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
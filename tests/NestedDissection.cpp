@@ -10,6 +10,57 @@
 #include "clique.hpp"
 using namespace cliq;
 
+// Ensure that each local subtree is stored contiguously in postorder, with 
+// the children of each node in increasing order, and that each original 
+// lower structure only references later vertices. The local nodes with zero,
+// one, two, and more than two children are also counted.
+void
+CheckLocalTree( const DistSymmInfo& info, std::vector<int>& childCounts )
+{
+    const int numLocalNodes = info.localNodes.size();
+    std::vector<int> subtreeOffs( numLocalNodes );
+    childCounts.assign( 4, 0 );
+    for( int s=0; s<numLocalNodes; ++s )
+    {
+        const SymmNodeInfo& node = info.localNodes[s];
+        const int numChildren = node.children.size();
+        ++childCounts[std::min(numChildren,3)];
+        if( (node.parent == -1) != (s == numLocalNodes-1) )
+            LogicError("Only the last local node should be a root");
+        if( node.parent != -1 && node.parent <= s )
+            LogicError("Parents must be ordered after their children");
+        int subtreeOff = node.off;
+        if( numChildren > 0 )
+            subtreeOff = subtreeOffs[node.children[0]];
+        int nextOff = subtreeOff;
+        for( int c=0; c<numChildren; ++c )
+        {
+            const int child = node.children[c];
+            if( c > 0 && child <= node.children[c-1] )
+                LogicError("Children must be in increasing order");
+            if( info.localNodes[child].parent != s || 
+                info.localNodes[child].whichChild != c )
+                LogicError("Child does not point back to its parent");
+            if( subtreeOffs[child] != nextOff )
+                LogicError("Child subtrees are not contiguous");
+            nextOff = info.localNodes[child].off + 
+                      info.localNodes[child].size;
+        }
+        if( nextOff != node.off )
+            LogicError("Subtree does not end with its root");
+        subtreeOffs[s] = subtreeOff;
+
+        const std::vector<int>& origLowerStruct = node.origLowerStruct;
+        const int numOrig = origLowerStruct.size();
+        for( int k=0; k<numOrig; ++k )
+        {
+            if( origLowerStruct[k] < node.off+node.size ||
+                (k > 0 && origLowerStruct[k] <= origLowerStruct[k-1]) )
+                LogicError("Invalid original lower structure");
+        }
+    }
+}
+
 int
 main( int argc, char* argv[] )
 {
@@ -93,6 +144,20 @@ main( int argc, char* argv[] )
         if( commRank == 0 )
             std::cout << "done" << std::endl;
 
+        // The leaves are split into subtrees of supernodes with minimum 
+        // degree, so check the map and the local trees on every process
+        if( commRank == 0 )
+        {
+            std::cout << "Checking the map and the local trees...";
+            std::cout.flush();
+        }
+        EnsurePermutation( map );
+        std::vector<int> childCounts;
+        CheckLocalTree( info, childCounts );
+        mpi::Barrier( comm );
+        if( commRank == 0 )
+            std::cout << "done" << std::endl;
+
         if( commRank == 0 )
         {
             const int numDistNodes = info.distNodes.size();
@@ -104,6 +169,10 @@ main( int argc, char* argv[] )
                       << numLocalNodes << " local nodes\n"
                       << numDistNodes  << " distributed nodes\n"
                       << rootSepSize << " vertices in root separator\n"
+                      << childCounts[0] << " local leaves\n"
+                      << childCounts[1] << " local nodes with one child\n"
+                      << childCounts[2] << " local nodes with two children\n"
+                      << childCounts[3] << " local nodes with more children\n"
                       << "\n";
             for( int s=0; s<rootSepSize; ++s )
             {
@@ -0,0 +1,255 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, and Stanford University
+   All rights reserved.
+ 
+   This file is part of Clique and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "clique.hpp"
+using namespace cliq;
+
+// Count the differences between a (possibly cached) entry and the results of
+// a fresh call to NestedDissection (on this process)
+int
+CountDifferences
+( const DistMap& map, const DistSeparatorTree& sepTree, 
+  const DistSymmInfo& info, const NestedDissectionEntry& entry )
+{
+    int numDiffs = ( map.Map() != entry.map.Map() );
+
+    const int numLocalSeps = sepTree.localSepsAndLeaves.size();
+    const int numDistSeps = sepTree.distSeps.size();
+    if( (int)entry.sepTree.localSepsAndLeaves.size() != numLocalSeps ||
+        (int)entry.sepTree.distSeps.size() != numDistSeps )
+        return numDiffs+1;
+    for( int s=0; s<numLocalSeps; ++s )
+    {
+        const SepOrLeaf& a = *sepTree.localSepsAndLeaves[s];
+        const SepOrLeaf& b = *entry.sepTree.localSepsAndLeaves[s];
+        numDiffs += ( a.parent != b.parent || a.off != b.off || 
+                      a.inds != b.inds );
+    }
+    for( int s=0; s<numDistSeps; ++s )
+    {
+        const DistSeparator& a = sepTree.distSeps[s];
+        const DistSeparator& b = entry.sepTree.distSeps[s];
+        numDiffs += ( a.off != b.off || a.inds != b.inds ||
+                      mpi::CommSize(a.comm) != mpi::CommSize(b.comm) );
+    }
+
+    const int numLocalNodes = info.localNodes.size();
+    const int numDistNodes = info.distNodes.size();
+    if( (int)entry.info.localNodes.size() != numLocalNodes ||
+        (int)entry.info.distNodes.size() != numDistNodes )
+        return numDiffs+1;
+    for( int s=0; s<numLocalNodes; ++s )
+    {
+        const SymmNodeInfo& a = info.localNodes[s];
+        const SymmNodeInfo& b = entry.info.localNodes[s];
+        numDiffs += ( a.size != b.size || a.off != b.off || 
+                      a.parent != b.parent || a.children != b.children ||
+                      a.whichChild != b.whichChild || a.myOff != b.myOff ||
+                      a.origLowerStruct != b.origLowerStruct ||
+                      a.lowerStruct != b.lowerStruct ||
+                      a.origLowerRelInds != b.origLowerRelInds ||
+                      a.childRelInds != b.childRelInds );
+    }
+    for( int s=0; s<numDistNodes; ++s )
+    {
+        const DistSymmNodeInfo& a = info.distNodes[s];
+        const DistSymmNodeInfo& b = entry.info.distNodes[s];
+        numDiffs += ( a.size != b.size || a.off != b.off || 
+                      a.onLeft != b.onLeft || a.myOff != b.myOff ||
+                      a.leftSize != b.leftSize || a.rightSize != b.rightSize ||
+                      a.origLowerStruct != b.origLowerStruct ||
+                      a.lowerStruct != b.lowerStruct ||
+                      a.origLowerRelInds != b.origLowerRelInds ||
+                      a.leftRelInds != b.leftRelInds ||
+                      a.rightRelInds != b.rightRelInds ||
+                      a.grid->Height() != b.grid->Height() ||
+                      a.grid->Width() != b.grid->Width() ||
+                      a.grid->Rank() != b.grid->Rank() ||
+                      a.factorMeta.numChildSendInds != 
+                      b.factorMeta.numChildSendInds );
+    }
+    return numDiffs;
+}
+
+void
+CheckEntry
+( const DistMap& map, const DistSeparatorTree& sepTree, 
+  const DistSymmInfo& info, const NestedDissectionEntry& entry, 
+  const std::string& label, mpi::Comm comm )
+{
+    const int numLocalDiffs = CountDifferences( map, sepTree, info, entry );
+    const int numDiffs = mpi::AllReduce( numLocalDiffs, mpi::SUM, comm );
+    if( numDiffs != 0 )
+    {
+        std::ostringstream msg;
+        msg << label << " differed from NestedDissection in " << numDiffs 
+            << " places";
+        RuntimeError( msg.str() );
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        const int n = Input("--n","size of n x n x n grid",20);
+        const bool sequential = Input
+            ("--sequential","sequential partitions?",true);
+        const int numDistSeps = Input
+            ("--numDistSeps",
+             "number of separators to try per distributed partition",1);
+        const int numSeqSeps = Input
+            ("--numSeqSeps",
+             "number of separators to try per sequential partition",1);
+        const int cutoff = Input("--cutoff","cutoff for nested dissection",128);
+        const std::string directory = Input
+            ("--directory","existing directory for the cached orderings",
+             std::string("."));
+        ProcessInput();
+
+        // Fill our portion of the graph of a 3D n x n x n 7-point stencil
+        const int numVertices = n*n*n;
+        DistGraph graph( numVertices, comm );
+        const int firstLocalSource = graph.FirstLocalSource();
+        const int numLocalSources = graph.NumLocalSources();
+        graph.StartAssembly();
+        graph.Reserve( 7*numLocalSources );
+        for( int iLocal=0; iLocal<numLocalSources; ++iLocal )
+        {
+            const int i = firstLocalSource + iLocal;
+            const int x = i % n;
+            const int y = (i/n) % n;
+            const int z = i/(n*n);
+
+            graph.Insert( i, i );
+            if( x != 0 )
+                graph.Insert( i, i-1 );
+            if( x != n-1 )
+                graph.Insert( i, i+1 );
+            if( y != 0 )
+                graph.Insert( i, i-n );
+            if( y != n-1 )
+                graph.Insert( i, i+n );
+            if( z != 0 )
+                graph.Insert( i, i-n*n );
+            if( z != n-1 )
+                graph.Insert( i, i+n*n );
+        }
+        graph.StopAssembly();
+
+        // The reference ordering
+        DistSymmInfo info;
+        DistSeparatorTree sepTree;
+        DistMap map;
+        NestedDissection
+        ( graph, map, sepTree, info, 
+          sequential, numDistSeps, numSeqSeps, cutoff );
+
+        // Two in-memory analyses should result in a single miss and a hit 
+        // which returns the same entry
+        if( commRank == 0 )
+        {
+            std::cout << "Checking an in-memory cache...";
+            std::cout.flush();
+        }
+        {
+            NestedDissectionCache cache;
+            const NestedDissectionEntry& first = 
+                cache.Analyze
+                ( graph, sequential, numDistSeps, numSeqSeps, cutoff );
+            const NestedDissectionEntry& second = 
+                cache.Analyze
+                ( graph, sequential, numDistSeps, numSeqSeps, cutoff );
+            if( &first != &second || cache.NumEntries() != 1 ||
+                cache.NumMisses() != 1 || cache.NumHits() != 1 )
+                LogicError("Second analysis was not a cache hit");
+            CheckEntry( map, sepTree, info, first, "In-memory entry", comm );
+
+            // A different cutoff must not hit the existing entry
+            cache.Analyze
+            ( graph, sequential, numDistSeps, numSeqSeps, cutoff+1 );
+            if( cache.NumEntries() != 2 || cache.NumMisses() != 2 )
+                LogicError("Analysis with a new cutoff was a cache hit");
+            cache.Clear();
+            if( cache.NumEntries() != 0 )
+                LogicError("Clear did not release the entries");
+        }
+        mpi::Barrier( comm );
+        if( commRank == 0 )
+            std::cout << "done" << std::endl;
+
+        // Write the ordering through one cache and read it back through 
+        // another, which must replay the communicator splits and rerun the
+        // symbolic analysis
+        if( commRank == 0 )
+        {
+            std::cout << "Checking a cache directory...";
+            std::cout.flush();
+        }
+        std::ostringstream fileName;
+        fileName << directory << "/nd-" << std::hex 
+                 << GraphFingerprint( graph ) << std::dec << "-" 
+                 << sequential << "-" << numDistSeps << "-" << numSeqSeps 
+                 << "-" << cutoff << "-" << commSize << "-" << commRank 
+                 << ".bin";
+        std::remove( fileName.str().c_str() );
+        {
+            NestedDissectionCache writer( directory );
+            writer.Analyze
+            ( graph, sequential, numDistSeps, numSeqSeps, cutoff );
+            if( writer.NumLoads() != 0 )
+                LogicError("Writer read an ordering from the directory");
+        }
+        std::ifstream file( fileName.str().c_str() );
+        const int localMissing = !file.is_open();
+        file.close();
+        if( mpi::AllReduce( localMissing, mpi::SUM, comm ) != 0 )
+            RuntimeError("The cached ordering was not written");
+        {
+            NestedDissectionCache reader( directory );
+            const NestedDissectionEntry& entry = 
+                reader.Analyze
+                ( graph, sequential, numDistSeps, numSeqSeps, cutoff );
+            if( reader.NumMisses() != 1 || reader.NumLoads() != 1 )
+                LogicError("The ordering was not read from the file");
+            CheckEntry( map, sepTree, info, entry, "Loaded entry", comm );
+        }
+
+        // A file whose size header disagrees with its length must be ignored
+        {
+            std::ofstream corrupt
+            ( fileName.str().c_str(), std::ios::out|std::ios::binary );
+            const int bogusSize = 1 << 30;
+            corrupt.write
+            ( reinterpret_cast<const char*>(&bogusSize), sizeof(int) );
+            corrupt.close();
+            NestedDissectionCache reader( directory );
+            const NestedDissectionEntry& entry = 
+                reader.Analyze
+                ( graph, sequential, numDistSeps, numSeqSeps, cutoff );
+            if( reader.NumLoads() != 0 )
+                LogicError("A corrupted ordering was read from the file");
+            CheckEntry( map, sepTree, info, entry, "Recomputed entry", comm );
+        }
+        std::remove( fileName.str().c_str() );
+        mpi::Barrier( comm );
+        if( commRank == 0 )
+            std::cout << "done" << std::endl;
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
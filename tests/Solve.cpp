@@ -38,6 +38,7 @@ main( int argc, char* argv[] )
         const int nbFact = Input("--nbFact","factorization blocksize",96);
         const int nbSolve = Input("--nbSolve","solve blocksize",96);
         const int cutoff = Input("--cutoff","cutoff for nested dissection",128);
+        const double tol = Input("--tol","maximum relative residual",1e-8);
         const bool print = Input("--print","print matrix?",false);
         const bool display = Input("--display","display matrix?",false);
         ProcessInput();
@@ -322,6 +323,13 @@ main( int argc, char* argv[] )
         Axpy( -1., X, Y );
         std::vector<double> errorNorms;
         Norms( Y, errorNorms );
+
+        // Since Y now holds xComp - x, A Y is the residual A xComp - A x
+        DistMultiVec<double> R( N, numRhs, comm );
+        MakeZeros( R );
+        Multiply( 1., A, Y, 0., R );
+        std::vector<double> residNorms;
+        Norms( R, residNorms );
         if( commRank == 0 )
         {
             for( int j=0; j<numRhs; ++j )
@@ -331,9 +339,22 @@ main( int argc, char* argv[] )
                           << "|| xComp ||_2 = " << YNorms[j] << "\n"
                           << "|| A x   ||_2 = " << YOrigNorms[j] << "\n"
                           << "|| error ||_2 = " << errorNorms[j] << "\n"
+                          << "|| resid ||_2 = " << residNorms[j] << "\n"
                           << std::endl;
             }
         }
+        // (Running with '--natural false' exercises the minimum-degree 
+        // ordering of the nested dissection leaves)
+        for( int j=0; j<numRhs; ++j )
+        {
+            if( residNorms[j] > tol*YOrigNorms[j] )
+            {
+                std::ostringstream msg;
+                msg << "Relative residual of right-hand side " << j << " was "
+                    << residNorms[j]/YOrigNorms[j] << " > " << tol;
+                RuntimeError( msg.str() );
+            }
+        }
     }
     catch( std::exception& e ) { ReportException(e); }
 